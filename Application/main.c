@@ -39,11 +39,18 @@
 
 #include "../Drivers/Inc/I2C_Interface.h"
 #include "../Drivers/Inc/UART_Interface.h"
-#include "../Drivers/Inc/SYSTICK_Interface.h"
 
 #include "../HAL/Inc/DS1307_Interface.h"
 
+#include "../Drivers/Inc/SPI_Interface.h"
+
+#include "../Service/Inc/Event_Loop.h"
 #include "../Service/Inc/Service.h"
+#include "../Service/Inc/Panda_Link.h"
+#include "../Service/Inc/Display_Stream.h"
+#include "../Service/Inc/Clock_Node.h"
+#include "../Service/Inc/Timebase.h"
+#include "../Service/Inc/Timer_Wheel.h"
 
 /* ========================================================================= *
  *                        GLOBAL VARIABLES SECTION                           *
@@ -57,6 +64,22 @@ extern DS1307_Config_t Date_Time_RTC;
 /* Variable to Store the Configuration of I2C1 that will be Used in the Application ( In Setting Date & Time ) */
 extern I2C_Configs_t *I2C_CONFIG;
 
+/* ========================================================================= *
+ *                   EVENT HANDLERS PROTOTYPES SECTION                       *
+ * ========================================================================= */
+
+/* Stream Time to Panda LCD & Compare Alarms , EVENT_SERVICE_TICK */
+static void ServiceTick_Handler(const EVENT_t *Event);
+
+/* Send a Due Alarm to Panda , EVENT_ALARM_MATCH */
+static void AlarmMatch_Handler(const EVENT_t *Event);
+
+/* Pulse The Blue Pill Once Alarm Frame is Out , EVENT_SPI_DONE */
+static void SpiDone_Handler(const EVENT_t *Event);
+
+/* Panda Buttons & Alarm Acknowledges , EVENT_PANDA_INPUT */
+static void PandaInput_Handler(const EVENT_t *Event);
+
 /* ========================================================================= *
  *                        MAIN APPLICATION SECTION                           *
  * ========================================================================= */
@@ -80,24 +103,59 @@ int main(void)
 	/* Enable Clock on Used Peripherals Only */
 	Clock_Init();
 
+	/* Interrupts Only Post Events , Queue Must be Ready Before Any is Enabled */
+	EventLoop_Init();
+	EventLoop_Subscribe(EVENT_SERVICE_TICK, &ServiceTick_Handler);
+	EventLoop_Subscribe(EVENT_ALARM_MATCH, &AlarmMatch_Handler);
+	EventLoop_Subscribe(EVENT_SPI_DONE, &SpiDone_Handler);
+	EventLoop_Subscribe(EVENT_PANDA_INPUT, &PandaInput_Handler);
+
 	/* Set Pins Configurations */
 	Pins_Init();
 
 	/* NVIC Interrupts Configuration */
 	Interrupts_Init();
 
+	/* Software Timers Are Turned by Timebase Tick , So Wheel is Emptied First */
+	TimerWheel_Init();
+
+	/* Start 1 ms Uptime & Cycle Counter , Terminal Pauses Rely on it */
+	Timebase_Init();
+
 	/* Initialize USART2 */
 	USART2_Init();
 
 	/* Initialize SPI1 */
 	SPI1_Init();
 
+	/* Initialize SPI1 Tx & Rx DMA Streams */
+	SPI1_DMA_Init();
+
+	/* Deselect Every Panda Board Sharing SPI1 */
+	PandaLink_Init();
+
+	/* Route Panda Buttons & Alarm Acknowledges Clocked Back in Frame Replies to Alarm Engine */
+	PandaLink_SetEventCallBack(&PandaEvent_ISR);
+
 	/* Initialize I2C1 */
 	I2C1_Init();
 
+#if CLOCK_NODE == ENABLED
+	/* Listen For Time & Alarm Table Frames From Master Clock */
+	ClockNode_Init();
+#endif
+
 	/* Clear Terminal Window With Every Reset */
 	Clear_Terminal();
 
+#if SPI1_BENCHMARK == ENABLED
+	/* Report SPI1 Throughput at Every Prescaler */
+	SPI1_Benchmark();
+#endif
+
+	/* Lock SPI1 at The Fastest Speed Panda Board Follows */
+	SPI1_Calibrate();
+
 	/* Receive ID From User */
 	ID_Ptr = ID_Reception();
 
@@ -110,7 +168,9 @@ int main(void)
 	 */
 	Check_LoginInfo(ID_Ptr, Pass_Ptr, NUM_OF_TRIES);
 
-
+	/* Configuring SYSTICK To Drive Background Services Every SERVICE_TICK_MS
+	 * ( Display Streaming & Comparing Alarms Set By User With Real Time From RTC ) */
+	Timebase_SetPeriodicCallBack(SERVICE_TICK_MS, &SysTickPeriodicISR);
 
 	while (1)
 	{
@@ -129,22 +189,18 @@ int main(void)
 		 * ========================================================================= */
 		case DISPLAY_OPTION:
 
-			/* Read Date & Time */
-			Reading_Time();
-
-			/* Transmit Date & Time  */
-			Transmit_Time();
+			/* Keep Pushing Date & Time to Panda LCD in The Background */
+			DisplayStream_Start(DISPLAY_STREAM_DEFAULT_RATE);
 
 			break;
 
 		case SET_ALARM_OPTION:
 
-			/* Set Alarm */
+			/* Set Alarm , Checked Every Second by Service Tick Event */
 			SetAlarm();
 
-			/* Configuring SYSTICK To Call CompTime Function Every One Second
-			to Compare Between Alarm Set By User & Real Time From RTC */
-			SYSTICK_voidSetINT(1000, 1, &SysTickPeriodicISR);
+			/* Clock Node Rings The Same Alarms */
+			ClockNode_SendAlarms();
 
 			break;
 
@@ -160,9 +216,13 @@ int main(void)
 				{
 
 					/*Receiving Calender from user is done Successfully*/
-					/*Write the Received Calender in the RTC Module*/
+					/*Write the Received Calender in the RTC Module ,
+					 * Services Reading RTC Run as Events in This Same Context So They Cannot Cut This Transaction*/
 					DS1307_WriteDateTime(I2C_CONFIG, &Date_Time_RTC);
 
+					/* Clock Node Follows The New Time */
+					ClockNode_SendTime(&Date_Time_RTC);
+
 					/*Display message to user that the time settled successfully*/
 					USART_SendStringPolling(UART_2, "\nThe Given Time Settled successfully\n");
 
@@ -201,9 +261,67 @@ void SPI_CallBackFunc(void)
 	ShutDown_Sequence();
 }
 
-/* SYSTICK ISR to Compare Between Alarm Set By User & Real Time From RTC */
+/* SYSTICK ISR Comes Every SERVICE_TICK_MS , Stream & Alarm Work Runs in Main Loop */
 void SysTickPeriodicISR()
 {
-	/* Systick ISR to Compare Time Comes Every 1 second */
-	CompTime();
+	EventLoop_Post(EVENT_SERVICE_TICK, 0, 0);
+}
+
+/* Panda Events Come in SPI1 DMA Interrupt , Alarm Engine Handles Them in Main Loop */
+void PandaEvent_ISR(uint8_t Event)
+{
+	EventLoop_Post(EVENT_PANDA_INPUT, Event, 0);
+}
+
+/* ========================================================================= *
+ *                        EVENT HANDLERS SECTION                             *
+ * ========================================================================= */
+
+/* Stream Time to Panda LCD Every SERVICE_TICK_MS &
+   Compare Between Alarm Set By User & Real Time From RTC Every Second */
+static void ServiceTick_Handler(const EVENT_t *Event)
+{
+	/* Ticks Passed Since Last Alarm Check */
+	static uint8_t TicksCounter = 0;
+
+	/* RTC Time Read This Tick , NULL Lets Display Stream Read it Only While Running */
+	DS1307_Config_t *Time = NULL;
+
+	(void)Event;
+
+	/* Compare Time Every 1 second */
+	if (++TicksCounter == (1000u / SERVICE_TICK_MS))
+	{
+		TicksCounter = 0;
+#if CLOCK_NODE == ENABLED
+		/* Take Master Clock Time & Alarms Before Comparing */
+		ClockNode_Tick();
+#endif
+		/* One Polled I2C Read With Interrupts Enabled Serves Alarm Check & LCD Frame */
+		Time = DS1307_ReadDateTime(I2C_CONFIG);
+		CompTime(Time);
+	}
+
+	/* Push Time to Panda LCD When a Frame is Due */
+	DisplayStream_Tick(Time);
+}
+
+/* Send Alarm Found Due by CompTime */
+static void AlarmMatch_Handler(const EVENT_t *Event)
+{
+	AlarmSend(Event->Arg);
+}
+
+/* Alarm Frame is Out , Pulse The Blue Pill */
+static void SpiDone_Handler(const EVENT_t *Event)
+{
+	(void)Event;
+
+	AlarmPulse_Start();
+}
+
+/* Panda Buttons & Alarm Acknowledges */
+static void PandaInput_Handler(const EVENT_t *Event)
+{
+	AlarmEvent(Event->Arg);
 }
@@ -26,9 +26,9 @@
  * CONFIGURATION
  * ====================================================================== */
 
-/* For Options Refer To Interface File :  @SYSTICK_EXCEPTION_t  &  @SYSTICK_CLK_SOURCE_t */
+/* For Options Refer To Interface File :  @SYSTICK_EXCEPTION_t  &  @SYSTICK_CLK_SOURCE_t , HCLK is AHB Clock in Hz */
 
 SYSTICK_CONFIG_t SYSTICK_TIMER_CONFIG =
 {
-  .Exception = DISABLE_SYSTICK_EXCEPTION , .CLK = SYSTICK_AHB_BY8
+  .Exception = DISABLE_SYSTICK_EXCEPTION , .CLK = SYSTICK_AHB_BY8 , .HCLK = SYSTICK_HCLK_HZ
 };
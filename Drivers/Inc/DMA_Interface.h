@@ -132,6 +132,17 @@ typedef enum
     DMA_DOUBLE_BUFFER_EN = 1   /* Double Buffer Mode Enable */
 } DMA_DOUBLE_BUFFER_t;
 
+/**
+ * @brief : Enum that holds The Two Memory Buffers of a Double Buffer Stream
+ * @enum  : @DMA_BUFFER_t
+ */
+typedef enum
+{
+    DMA_BUFFER0 = 0, /* Memory 0 ( M0AR ) */
+    DMA_BUFFER1 = 1  /* Memory 1 ( M1AR ) */
+
+} DMA_BUFFER_t;
+
 /**
  * @brief : Enum that holds Options for Memory Data Width
  * @enum  : @DMA_MEM_WIDTH_t
@@ -266,6 +277,62 @@ typedef enum
 
 } DMA_CALLBACK_ID_t;
 
+/**
+ * @brief : Call Back Carrying The Stream That Raised The Interrupt & The Context Given at Registration
+ * @type  : @DMA_CONTEXT_CALLBACK_t
+ */
+typedef void (*DMA_CONTEXT_CALLBACK_t)(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_CALLBACK_ID_t CallBackID, void *Context);
+
+/**
+ * @brief : Enum that holds Peripheral DMA Requests Served by The Stream Allocator ( STM32F446 Request Mapping )
+ * @enum  : @DMA_REQUEST_t
+ */
+typedef enum
+{
+    DMA_REQ_SPI1_RX = 0,
+    DMA_REQ_SPI1_TX,
+    DMA_REQ_SPI2_RX,
+    DMA_REQ_SPI2_TX,
+    DMA_REQ_SPI3_RX,
+    DMA_REQ_SPI3_TX,
+    DMA_REQ_SPI4_RX,
+    DMA_REQ_SPI4_TX,
+    DMA_REQ_USART1_RX,
+    DMA_REQ_USART1_TX,
+    DMA_REQ_USART2_RX,
+    DMA_REQ_USART2_TX,
+    DMA_REQ_USART3_RX,
+    DMA_REQ_USART3_TX,
+    DMA_REQ_UART4_RX,
+    DMA_REQ_UART4_TX,
+    DMA_REQ_UART5_RX,
+    DMA_REQ_UART5_TX,
+    DMA_REQ_USART6_RX,
+    DMA_REQ_USART6_TX,
+    DMA_REQ_I2C1_RX,
+    DMA_REQ_I2C1_TX,
+    DMA_REQ_I2C2_RX,
+    DMA_REQ_I2C2_TX,
+    DMA_REQ_I2C3_RX,
+    DMA_REQ_I2C3_TX,
+    DMA_REQ_MEM_TO_MEM, /* Any Free DMA2 Stream , Only DMA2 Can Copy Memory to Memory */
+    DMA_REQUEST_NUMBER
+
+} DMA_REQUEST_t;
+
+/**
+ * @brief : Struct that holds One Segment of a Descriptor Chain , Segments Are Sent Back to Back on The Same Stream
+ * @struct: @DMA_SEGMENT_t
+ */
+typedef struct
+{
+    uint32_t *SrcAddress;  /* Segment Source */
+    uint32_t *DestAddress; /* Segment Destination */
+    uint16_t DataLength;   /* Number of Data Transfers , Must Not be 0 */
+    uint8_t Flags;         /* Segment Flags -> Check Options ( @DMA_SEGMENT_FLAGS ) */
+
+} DMA_SEGMENT_t;
+
 /**
  * @brief : Struct that holds all configurations of the DMA
  * @struct: @DMA_INIT_STRUCT_t
@@ -290,6 +357,112 @@ typedef struct
     DMA_FIFO_THRESHOLD_t FIFOThreshold; /* DMA FIFO Threshold */
 } DMA_INIT_STRUCT_t;
 
+/**
+ * @brief : Struct that holds Composed Register Values of a Stream , Built by ( @DMA_ComposeConfig )
+ * @struct: @DMA_STREAM_CONFIG_t
+ */
+typedef struct
+{
+    DMA_CONTROLLER_t DMAController; /* DMA Controller Number */
+    DMA_STREAMS_t StreamNumber;     /* DMA Stream Number */
+    uint32_t CR;                    /* Stream Configuration Register , Enable Bit Cleared */
+    uint32_t FCR;                   /* Stream FIFO Control Register */
+
+} DMA_STREAM_CONFIG_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* -------------------------------- SEGMENT FLAGS SECTION START ----------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief : Options For Flags of a Chain Segment ( @DMA_SEGMENT_t ) , Can be ORed
+ * @group : @DMA_SEGMENT_FLAGS
+ */
+#define DMA_SEGMENT_FLAG_NONE 0x00U      /* Increment as Configured in Init Structure */
+#define DMA_SEGMENT_FLAG_HOLD_SRC 0x01U  /* Source Address Not Incremented ( Repeat One Item , e.g. Padding ) */
+#define DMA_SEGMENT_FLAG_HOLD_DEST 0x02U /* Destination Address Not Incremented */
+
+/* ------------------------------------------------------------------------------------------------ */
+/* --------------------------------- SEGMENT FLAGS SECTION END ------------------------------------ */
+/* ------------------------------------------------------------------------------------------------ */
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- REQUEST MAPPING SECTION START ---------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/* Controller , Stream & Channel Packed in One Byte So Mappings Can be Compared at Compile Time */
+#define DMA_MAP(CONTROLLER, STREAM, CHANNEL) ((uint8_t)(((CONTROLLER) << 6) | ((STREAM) << 3) | (CHANNEL)))
+#define DMA_MAP_NONE 0xFFU
+
+/* Streams & Channels Able to Serve Every Request ( RM0390 DMA1 / DMA2 Request Mapping Tables ) */
+#define DMA_REQ_SPI1_RX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM0, DMA_CHANNEL3)
+#define DMA_REQ_SPI1_RX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM2, DMA_CHANNEL3)
+#define DMA_REQ_SPI1_TX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM3, DMA_CHANNEL3)
+#define DMA_REQ_SPI1_TX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM5, DMA_CHANNEL3)
+#define DMA_REQ_SPI2_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM3, DMA_CHANNEL0)
+#define DMA_REQ_SPI2_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_SPI2_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM4, DMA_CHANNEL0)
+#define DMA_REQ_SPI2_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_SPI3_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM0, DMA_CHANNEL0)
+#define DMA_REQ_SPI3_RX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM2, DMA_CHANNEL0)
+#define DMA_REQ_SPI3_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM5, DMA_CHANNEL0)
+#define DMA_REQ_SPI3_TX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM7, DMA_CHANNEL0)
+#define DMA_REQ_SPI4_RX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM0, DMA_CHANNEL4)
+#define DMA_REQ_SPI4_RX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM3, DMA_CHANNEL5)
+#define DMA_REQ_SPI4_TX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM1, DMA_CHANNEL4)
+#define DMA_REQ_SPI4_TX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM4, DMA_CHANNEL5)
+#define DMA_REQ_USART1_RX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM2, DMA_CHANNEL4)
+#define DMA_REQ_USART1_RX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM5, DMA_CHANNEL4)
+#define DMA_REQ_USART1_TX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM7, DMA_CHANNEL4)
+#define DMA_REQ_USART1_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_USART2_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM5, DMA_CHANNEL4)
+#define DMA_REQ_USART2_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_USART2_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM6, DMA_CHANNEL4)
+#define DMA_REQ_USART2_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_USART3_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM1, DMA_CHANNEL4)
+#define DMA_REQ_USART3_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_USART3_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM3, DMA_CHANNEL4)
+#define DMA_REQ_USART3_TX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM4, DMA_CHANNEL7)
+#define DMA_REQ_UART4_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM2, DMA_CHANNEL4)
+#define DMA_REQ_UART4_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_UART4_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM4, DMA_CHANNEL4)
+#define DMA_REQ_UART4_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_UART5_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM0, DMA_CHANNEL4)
+#define DMA_REQ_UART5_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_UART5_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM7, DMA_CHANNEL4)
+#define DMA_REQ_UART5_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_USART6_RX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM1, DMA_CHANNEL5)
+#define DMA_REQ_USART6_RX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM2, DMA_CHANNEL5)
+#define DMA_REQ_USART6_TX_OPTION1 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM6, DMA_CHANNEL5)
+#define DMA_REQ_USART6_TX_OPTION2 DMA_MAP(DMA2_CONTROLLER, DMA_STREAM7, DMA_CHANNEL5)
+#define DMA_REQ_I2C1_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM0, DMA_CHANNEL1)
+#define DMA_REQ_I2C1_RX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM5, DMA_CHANNEL1)
+#define DMA_REQ_I2C1_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM6, DMA_CHANNEL1)
+#define DMA_REQ_I2C1_TX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM7, DMA_CHANNEL1)
+#define DMA_REQ_I2C2_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM2, DMA_CHANNEL7)
+#define DMA_REQ_I2C2_RX_OPTION2 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM3, DMA_CHANNEL7)
+#define DMA_REQ_I2C2_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM7, DMA_CHANNEL7)
+#define DMA_REQ_I2C2_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_I2C3_RX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM2, DMA_CHANNEL3)
+#define DMA_REQ_I2C3_RX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_I2C3_TX_OPTION1 DMA_MAP(DMA1_CONTROLLER, DMA_STREAM4, DMA_CHANNEL3)
+#define DMA_REQ_I2C3_TX_OPTION2 DMA_MAP_NONE
+#define DMA_REQ_MEM_TO_MEM_OPTION1 DMA_MAP_NONE
+#define DMA_REQ_MEM_TO_MEM_OPTION2 DMA_MAP_NONE
+
+/* Non Zero if Stream & Channel of a Controller Can Serve a Request */
+#define DMA_MAPPING_VALID(REQUEST, CONTROLLER, STREAM, CHANNEL)           \
+    ((DMA_MAP(CONTROLLER, STREAM, CHANNEL) == REQUEST##_OPTION1) ||      \
+     (DMA_MAP(CONTROLLER, STREAM, CHANNEL) == REQUEST##_OPTION2))
+
+/* Reject at Build Time a Constant Configuration Wired to a Stream / Channel That Can't Serve its Request */
+#define DMA_STATIC_ASSERT_MAPPING(REQUEST, CONTROLLER, STREAM, CHANNEL) \
+    _Static_assert(DMA_MAPPING_VALID(REQUEST, CONTROLLER, STREAM, CHANNEL), #REQUEST " Is Not Mapped on This Stream / Channel")
+
+/* ------------------------------------------------------------------------------------------------ */
+/* -------------------------------- REQUEST MAPPING SECTION END ----------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
 /* ------------------------------------------------------------------------------------------------ */
 /* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
 /* ------------------------------------------------------------------------------------------------ */
@@ -315,6 +488,26 @@ Error_State_t DMA_ClearInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS
  */
 Error_State_t DMA_ReadInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_Interrupt_Flag_t InterruptFlag, DMA_Interrupt_Flag_Status_t *InterruptFlagStatus);
 
+/**
+ * @brief : The Function Reads All Interrupt Flags of A Specified Stream in One Status Register Access
+ *
+ * @param : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param : InterruptFlags => Pointer to a Variable that will hold Raised Flags , Bit ( 1 << Flag ) Per Flag -> Check Options ( @DMA_Interrupt_Flags_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ReadInterruptFlags(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint8_t *InterruptFlags);
+
+/**
+ * @brief : The Function Clears Several Interrupt Flags of A Specified Stream in One Clear Register Access
+ *
+ * @param : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param : InterruptFlags => Flags to Clear , Bit ( 1 << Flag ) Per Flag As Returned by DMA_ReadInterruptFlags
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ClearInterruptFlags(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint8_t InterruptFlags);
+
 /**
  * @brief : The Function Selects a Certain Channel on a Certain Stream in a Specifec DMA Controller
  *
@@ -358,11 +551,30 @@ Error_State_t DMA_SetStreamPriority(DMA_CONTROLLER_t DMAController, DMA_STREAMS_
  */
 Error_State_t DMA_Init(DMA_INIT_STRUCT_t *Init);
 
+/**
+ * @brief : This Function Builds The Full CR & FCR Values of a Stream From its Configurations Without Touching The Stream ,
+ *          Keep The Result to Reconfigure The Stream Later With Two Register Writes
+ *
+ * @param : Init => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param : StreamConfig => Pointer to Struct that will hold The Composed Values -> Check Struct ( @DMA_STREAM_CONFIG_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ComposeConfig(const DMA_INIT_STRUCT_t *Init, DMA_STREAM_CONFIG_t *StreamConfig);
+
+/**
+ * @brief : This Function Disables a Stream & Writes its Composed CR & FCR Values , Each With One Store
+ *
+ * @param : StreamConfig => Composed Values From ( @DMA_ComposeConfig ) -> Check Struct ( @DMA_STREAM_CONFIG_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note  : Stream Keeps These Values Between Transfers , Restarts Only Rewrite Number of Data & Addresses
+ */
+Error_State_t DMA_ApplyConfig(const DMA_STREAM_CONFIG_t *StreamConfig);
+
 /**
  * @brief : The Function Configures Interrupt Enabling Or Disabling Of All Interrupts in a Certain Stream in a Certain DMA Controller
  *
  * @param : DMA_InitConfig =>  Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
- * @note  : This Function is Being Called in DMA_Init Function , So No Need to Call it Again Unless You Want to Change Interrupt Configurations
+ * @note  : DMA_Init Already Writes Interrupt Enables , So No Need to Call it Unless You Want to Change Interrupt Configurations
  * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
  */
 Error_State_t DMA_EnableIT(DMA_INIT_STRUCT_t *DMA_InitConfig);
@@ -387,6 +599,65 @@ Error_State_t DMA_DisableStream(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t Stream
  */
 Error_State_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddress, uint32_t *DestAddress, uint16_t DataLength);
 
+/**
+ * @brief  : This Function Starts a Double Buffer ( Ping Pong ) Stream , DMA Begins With Buffer 0 & Switches to The Other
+ *           Buffer by Itself at Every Transfer Complete , With No Gap & No Restart
+ *
+ * @param  : InitConfig  => Struct that holds all configurations of the DMA , DoubleBuffer Must be Enabled -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : PeriphAddress => Pointer to The Peripheral Data Register
+ * @param  : Buffer0 => Pointer to First Memory Buffer ( M0AR )
+ * @param  : Buffer1 => Pointer to Second Memory Buffer ( M1AR )
+ * @param  : DataLength  => Number of Data Transfers Per Buffer
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Transfer Complete Call Back Fires Every Time a Buffer is Done , Refill it There ( @DMA_GetIdleBuffer )
+ */
+Error_State_t DMA_StartDoubleBuffer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *PeriphAddress, uint32_t *Buffer0, uint32_t *Buffer1, uint16_t DataLength);
+
+/**
+ * @brief  : This Function Reports The Buffer Software Owns Now ( The One DMA is Not Using , From CT Bit )
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : IdleBuffer => Pointer to a Variable that will hold The Idle Buffer -> Check Options ( @DMA_BUFFER_t )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_GetIdleBuffer(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_BUFFER_t *IdleBuffer);
+
+/**
+ * @brief  : This Function Points The Idle Buffer of a Running Double Buffer Stream to a New Memory Address
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Buffer => Buffer to Change -> Check Options ( @DMA_BUFFER_t )
+ * @param  : Address => Pointer to The New Memory Buffer
+ * @return : ERRORS_t => Error Status ( DMA_NOK if DMA is Currently Using That Buffer )
+ * @note   : Hardware Ignores Writes to The Address Register in Use , So Only The Idle One is Accepted
+ */
+Error_State_t DMA_SetBuffer(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_BUFFER_t Buffer, uint32_t *Address);
+
+/**
+ * @brief  : This Function Reports Number of Data Transfers a Stream Still Has to Do ( NDTR )
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Remaining => Pointer to a Variable that will hold Number of Transfers Left
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Length of a Transfer Ended Early by The Peripheral ( Slave Frame Cut by NSS ) is Programmed Length Minus Remaining
+ */
+Error_State_t DMA_GetRemaining(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint16_t *Remaining);
+
+/**
+ * @brief  : This Function Starts a Chain of Segments on a Stream , Transfer Complete Interrupt of Every Segment
+ *           Programs The Next One , Stream Transfer Complete Call Back is Called Once When Last Segment is Done
+ *
+ * @param  : InitConfig => Struct that holds all configurations of the DMA , Normal Mode With Transfer Complete Interrupt -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : Segments => Array of Segments , Must Stay Valid Till Chain is Done ( Buffers Are Not Copied )
+ * @param  : SegmentsNumber => Number of Segments in The Array
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : A Transfer Error Stops The Chain & Only The Error Call Back is Called
+ */
+Error_State_t DMA_StartChain(DMA_INIT_STRUCT_t *InitConfig, const DMA_SEGMENT_t *Segments, uint8_t SegmentsNumber);
+
 /**
  * @brief  : This Functoin Sets a CallBack Function to a Certain Interrupt
  * @fn     : DMA_SetCallBack
@@ -397,6 +668,50 @@ Error_State_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddr
  */
 Error_State_t DMA_SetCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t CallBackID, void (*Copy_pvCallBack)(void));
 
+/**
+ * @brief  : This Functoin Sets a CallBack Function That Receives The Stream & a User Context to a Certain Interrupt ,
+ *           So One Function Can Serve Many Streams
+ * @fn     : DMA_SetContextCallBack
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : CallBackID => Enum that holds All Possible Interrupts that can Occur in a Certain Stream -> Check Options ( @DMA_CALLBACK_ID_t )
+ * @param  : Copy_pvCallBack => Pointer to Function that will be Called when the Interrupt Occurs -> Check ( @DMA_CONTEXT_CALLBACK_t )
+ * @param  : Context => User Pointer Passed Back to The Call Back As it is ( May be NULL )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Replaces Call Back Set by ( @DMA_SetCallBack ) For The Same Interrupt & Vice Versa
+ */
+Error_State_t DMA_SetContextCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t CallBackID, DMA_CONTEXT_CALLBACK_t Copy_pvCallBack, void *Context);
+
+/**
+ * @brief  : This Function Picks a Free Stream Able to Serve a Request , Marks it Used & Writes Controller ,
+ *           Stream & Channel in The Configuration Structure ( Other Fields Are Not Touched )
+ * @fn     : DMA_AllocateStream
+ * @param  : Request => Peripheral Request to Serve -> Check Options ( @DMA_REQUEST_t )
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @return : ERRORS_t => Error Status ( DMA_WRONG_STREAM if Every Possible Stream is Taken )
+ * @note   : Called at Init , Before DMA_Init
+ */
+Error_State_t DMA_AllocateStream(DMA_REQUEST_t Request, DMA_INIT_STRUCT_t *InitConfig);
+
+/**
+ * @brief  : This Function Claims The Stream Already Written in a Configuration Structure For a Request ,
+ *           So Fixed Configurations & Allocated Ones Never Share a Stream
+ * @fn     : DMA_ReserveStream
+ * @param  : Request => Peripheral Request to Serve -> Check Options ( @DMA_REQUEST_t )
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @return : ERRORS_t => Error Status ( DMA_WRONG_CHANNEL if Mapping is Wrong , DMA_WRONG_STREAM if Stream is Taken )
+ * @note   : Constant Configurations Should Also be Checked by DMA_STATIC_ASSERT_MAPPING
+ */
+Error_State_t DMA_ReserveStream(DMA_REQUEST_t Request, const DMA_INIT_STRUCT_t *InitConfig);
+
+/**
+ * @brief  : This Function Gives Back a Stream Taken by DMA_AllocateStream or DMA_ReserveStream
+ * @fn     : DMA_ReleaseStream
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ReleaseStream(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
 /* ---------------------------------------------------------------------------------------------- */
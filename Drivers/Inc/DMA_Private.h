@@ -27,7 +27,7 @@
  * @note  : This Function is a Private Function , Specified For Driver Use Only
  * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly( DMA_OK ) or Not ( DMA_NOK )
  */
-static Error_State_t DMA_CheckInitConfig(DMA_INIT_STRUCT_t *DMA_InitConfig);
+static Error_State_t DMA_CheckInitConfig(const DMA_INIT_STRUCT_t *DMA_InitConfig);
 
 /**
  * @brief  : This Function Handles the Interrupts of the DMA When DMA IRQ Handler is Called
@@ -39,6 +39,30 @@ static Error_State_t DMA_CheckInitConfig(DMA_INIT_STRUCT_t *DMA_InitConfig);
  */
 static Error_State_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumber);
 
+/**
+ * @brief  : This Function Returns The Status Register ( LISR / HISR ) & Clear Register ( LIFCR / HIFCR ) of a Stream
+ *           Together With The Position of The Stream Flags Inside Them
+ *
+ * @param  : DMANumber => Enum that holds All Possible DMA Controllers -> Check Options ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds All Possible Streams -> Check Options ( @DMA_STREAMS_t )
+ * @param  : ISR => Pointer to Status Register Address
+ * @param  : IFCR => Pointer to Clear Register Address
+ * @return : uint8_t => Shift of The Stream Flags Group ( 0 , 6 , 16 or 22 )
+ * @note   : This Function is a Private Function , Specified For Driver Use Only , Arguments Are Already Checked
+ */
+static uint8_t DMA_GetFlagRegisters(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumber, volatile uint32_t **ISR, volatile uint32_t **IFCR);
+
+/**
+ * @brief  : This Function Programs a Chain Segment on a Disabled Stream & Enables it
+ *
+ * @param  : DMANumber => Enum that holds All Possible DMA Controllers -> Check Options ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds All Possible Streams -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Segment => Segment to Program -> Check Struct ( @DMA_SEGMENT_t )
+ * @return : void
+ * @note   : This Function is a Private Function , Specified For Driver Use Only , Arguments Are Already Checked
+ */
+static void DMA_LoadSegment(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumber, const DMA_SEGMENT_t *Segment);
+
 /* ======================================================================
  * MASKS
  * ====================================================================== */
@@ -58,9 +82,9 @@ static Error_State_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t St
 #define DMA_DMEIE_MASK 0xFFFFFFFDUL
 #define DMA_DBM_MASK 0xFFFBFFFF
 
-#define DMA_FEIE_MASK 0x3FUL
-#define DMA_DMDIS_MASK 0xBBUL
-#define DMA_FTH_MASK 0xBCUL
+#define DMA_FEIE_MASK 0xFFFFFF7FUL
+#define DMA_DMDIS_MASK 0xFFFFFFFBUL
+#define DMA_FTH_MASK 0xFFFFFFFCUL
 
 #define DMA_EN_MASK 0xFFFFFFFEUL
 
@@ -69,4 +93,31 @@ static Error_State_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t St
  * ====================================================================== */
 #define DMA_INT_NUM 5U
 
+/* Streams Sharing One Status / Clear Register ( LISR : 0 ~ 3 , HISR : 4 ~ 7 ) */
+#define DMA_STREAMS_PER_ISR 4U
+
+/* Position of Every Stream Flags Group Inside its Status / Clear Register */
+#define DMA_STREAM_FLAGS_OFFSETS \
+    {                            \
+        0U, 6U, 16U, 22U         \
+    }
+
+/* FEIF , DMEIF , TEIF , HTIF & TCIF Bits of a Flags Group ( Bit 1 is Reserved ) */
+#define DMA_STREAM_FLAGS_MASK 0x3DUL
+
+/* Stream / Channel Options Per Request in The Mapping Table */
+#define DMA_MAP_OPTIONS 2U
+
+/* Fields of a Packed Mapping ( @DMA_MAP ) */
+#define DMA_MAP_CONTROLLER(MAP) (((MAP) >> 6) & 0x01U)
+#define DMA_MAP_STREAM(MAP) (((MAP) >> 3) & 0x07U)
+#define DMA_MAP_CHANNEL(MAP) ((MAP)&0x07U)
+
+/* Memory to Memory Transfers Are Only Served by DMA2 , Allocator Searches From The Last Stream Down */
+#define DMA_MEM_TO_MEM_CONTROLLER DMA2_CONTROLLER
+#define DMA_MEM_TO_MEM_CHANNEL DMA_CHANNEL0
+
+/* Transfer Error & Direct Mode Error Stop a Descriptor Chain , FIFO Error Only Warns */
+#define DMA_CHAIN_ABORT_FLAGS ((1U << TRANSFER_ERROR_IT_FLAG) | (1U << DIRECT_MODE_ERROR_IT_FLAG))
+
 #endif /* DMA_PRIVATE_H_ */
@@ -119,6 +119,7 @@ typedef struct{
 	SPI_CHIP_MODE_t					Chip_Mode;
 	SPI_SLAVE_MANAGE_STATE_t		Slave_Manage_State;
 	SPI_CRC_STATE_t					CRC_State;
+	uint16_t						CRC_Polynomial;			/*Written to CRCPR if CRC is Enabled , 0 Keeps Reset Value (0x07)*/
 	SPI_MULTIMASTER_STATE_t			MultiMaster_State;
 }SPI_CONFIGS_t;
 /******** END OF MAIN USER DEFINED VARIABLES ***********/
@@ -136,13 +137,14 @@ Error_State_t SPI_Init(const SPI_CONFIGS_t * SPI_Config);
 
 /*
  * @function 		:	SPI_Transmit
- * @brief			:	Transmit Data via SPI
-* @param			:	SPI Configurations structure
- * @param			:	pointer to Data Buffer
- * @param 			: 	Data Buffer Size
+ * @brief			:	Transmit Data via SPI , Returns When The Last Frame is Shifted Out
+ * @param			:	SPI Configurations structure
+ * @param			:	pointer to Data Buffer ( In 16 Bits Mode Bytes Are Packed Two Per Frame , First Byte
+ * 						in MSB , Odd Last Byte is Padded )
+ * @param 			: 	Data Buffer Size ( Bytes )
  * @retval			:	Error State
  */
-Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint16_t * Data , uint8_t Buffer_Size);
+Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint8_t * Data , uint8_t Buffer_Size);
 
 /*
  * @function 		:	SPI_Receive
@@ -154,14 +156,26 @@ Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint16_t * Data , u
  */
 Error_State_t SPI_Receive(const SPI_CONFIGS_t * SPI_Config, uint16_t * Received_Data ,uint8_t Buffer_Size);
 
+/*
+ * @function 		:	SPI_TransmitReceive
+ * @brief			:	Full Duplex Polled Block Transfer , Sending & Receiving Are Interleaved
+ * @param			:	SPI Configurations structure
+ * @param			:	Data to Send ( NULL to Clock Out Garbage )
+ * @param			:	Buffer to save Received Data ( NULL to Drop it )
+ * @param 			: 	Data Buffer Size ( Elements )
+ * @retval			:	Error State
+ */
+Error_State_t SPI_TransmitReceive(const SPI_CONFIGS_t * SPI_Config, const uint16_t * Data , uint16_t * Received_Data , uint8_t Buffer_Size);
+
 
 /*
  * @function 		:	SPI_Transmit_IT
  * @brief			:	Transmit Data via SPI and
  * 						generate interrupt when Transmission is complete
  * @param			:	SPI Configurations structure
- * @param			:	Data To Send
- * @param 			: 	Data Buffer Size
+ * @param			:	Data To Send ( In 16 Bits Mode Bytes Are Packed Two Per Frame , First Byte in MSB ,
+ * 						Odd Last Byte is Padded )
+ * @param 			: 	Data Buffer Size ( Bytes )
  * @param			:	CallBack Function
  * @retval			:	Error State
  */
@@ -171,13 +185,34 @@ Error_State_t SPI_Transmit_IT(const SPI_CONFIGS_t * SPI_Config, uint8_t * Data ,
  * @function 		:	SPI_Receive_IT
  * @brief			:	Receive Data via SPI and generate interrupt when receive is complete
  * @param			:	SPI Configurations structure
- * @param			:	Buffer to save Data
- * @param 			: 	Data Buffer Size
+ * @param			:	Buffer to save Data ( In 16 Bits Mode Every Frame Fills Two Bytes , MSB First )
+ * @param 			: 	Data Buffer Size ( Bytes )
  * @param			:	CallBack Function
  * @retval			:	Error State
  */
 Error_State_t SPI_Receive_IT(const SPI_CONFIGS_t * SPI_Config, uint8_t * Received_Data ,uint8_t Buffer_Size , void (* SPI_RXC_CallBackFunc)(void));
 
+/*
+ * @function 		:	SPI_Slave_Start_Frame
+ * @brief			:	Arm Slave For One NSS Framed Transaction , Elements Are Drained From DR by
+ * 						The Caller RX DMA Stream ( SPI_Enable_DMA_RX ) Till NSS Rises
+ * @param			:	SPI NUMBER
+ * @param			:	Reply , First Element Clocked Out to Master
+ * @retval			:	Error State
+ */
+Error_State_t SPI_Slave_Start_Frame(SPI_SPI_NUMBER_t SPI_Num, uint8_t Reply);
+
+/*
+ * @function 		:	SPI_Slave_End_Frame
+ * @brief			:	Close NSS Framed Slave Reception , Reports Overrun ( an Element Lost Because DR
+ * 						Was Not Drained in Time ) & Resyncs The Slave For The Next Frame
+ * @param			:	SPI NUMBER
+ * @param			:	Pointer to Overrun Flag State ( FLAG_SET / FLAG_RESET )
+ * @retval			:	Error State
+ * @note			:	Called From NSS Rising Edge ( EXTI ) Handler Once RX DMA Stream is Stopped
+ */
+Error_State_t SPI_Slave_End_Frame(SPI_SPI_NUMBER_t SPI_Num, uint8_t * Overrun);
+
 /*
  * @function 		:	SPI_Enable_DMA_RX
  * @brief			:	Enable DMA Line for SPI Receiving
@@ -205,6 +240,54 @@ Error_State_t SPI_Enable_DMA_TX(SPI_SPI_NUMBER_t SPI_Num);
  */
 Error_State_t SPI_SET_Internal_Slave_State(SPI_SPI_NUMBER_t SPI_Num, SLAVE_STATE_t Slave_State);
 
+/*
+ * @function 		:	SPI_Flush_RX
+ * @brief			:	Wait Till SPI is Idle & Drop Stale Received Data ( Clears OVR )
+ * @param			:	SPI NUMBER
+ * @retval			:	Error State
+ * @note			:	Needed Before Polled Reception That Follows a Transmit Only ( DMA ) Transfer
+ */
+Error_State_t SPI_Flush_RX(SPI_SPI_NUMBER_t SPI_Num);
+
+/*
+ * @function 		:	SPI_Reset_CRC
+ * @brief			:	Wait Till SPI is Idle , Drop Stale Received Data & Restart CRC Calculation
+ * @param			:	SPI NUMBER
+ * @retval			:	Error State
+ * @note			:	SPI is Disabled For a Moment But NSS Pin is Not Driven ( Software Slave Management ,
+ * 						SSOE Off ) , Caller Ends The Slave Transaction Through its Chip Select Line
+ */
+Error_State_t SPI_Reset_CRC(SPI_SPI_NUMBER_t SPI_Num);
+
+/*
+ * @function 		:	SPI_Get_CRC_Error
+ * @brief			:	Read & Clear CRC Error Flag ( Received CRC Mismatch )
+ * @param			:	SPI NUMBER
+ * @param			:	Pointer to Flag State ( FLAG_SET / FLAG_RESET )
+ * @retval			:	Error State
+ */
+Error_State_t SPI_Get_CRC_Error(SPI_SPI_NUMBER_t SPI_Num, uint8_t * CRC_Error);
+
+/*
+ * @function 		:	SPI_Set_BaudRate
+ * @brief			:	Change Master Baud Rate Prescaler at Run Time
+ * @param			:	SPI NUMBER
+ * @param			:	New Baud Rate Prescaler
+ * @retval			:	Error State
+ * @note			:	Waits Till Current Frame is Shifted Out , BR Bits Can't be Changed While SPI is Enabled
+ */
+Error_State_t SPI_Set_BaudRate(SPI_SPI_NUMBER_t SPI_Num, SPI_BAUDRATE_VALUES_t BaudRate_Value);
+
+/*
+ * @function 		:	SPI_Set_CRC_State
+ * @brief			:	Turn Hardware CRC On or Off at Run Time , CRC Calculation Restarts Either Way
+ * @param			:	SPI NUMBER
+ * @param			:	New CRC State
+ * @retval			:	Error State
+ * @note			:	Waits Till Current Frame is Shifted Out , CRCEN Can't be Changed While SPI is Enabled
+ */
+Error_State_t SPI_Set_CRC_State(SPI_SPI_NUMBER_t SPI_Num, SPI_CRC_STATE_t CRC_State);
+
 
 /***************End of MAIN FUNCTIONS*******************/
 
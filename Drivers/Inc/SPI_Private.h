@@ -7,6 +7,27 @@
 #ifndef SPI_INC_SPI_PRIVATE_H_
 #define SPI_INC_SPI_PRIVATE_H_
 
+/****************** PRIVATE TYPES **********************/
+
+/*
+ * @struct			:	SPI_CONTEXT_t
+ * @brief			:	Transfer State Owned by Every SPI Peripheral
+ * 						So Transfers on Different SPIs Never Share Buffers or Counters
+ */
+typedef struct
+{
+	uint8_t *			Tx_Buffer;					/*Buffer Currently Transmitted*/
+	uint8_t *			Rx_Buffer;					/*Buffer Currently Filled by Reception*/
+	uint8_t				Buffer_Size;				/*Size of Current Transfer*/
+	uint16_t			Counter;					/*Elements Handled So Far*/
+	IRQ_SOURCES_t		IRQ_Source;					/*What the Next IRQ Belongs To*/
+	SPI_DATA_FRAME_SIZE_t	Frame_Size;				/*8 Bits : One Byte Per Frame , 16 Bits : Two Bytes Packed Per Frame*/
+	void 				(*TXC_CallBack)(void);		/*Transmission Complete Call Back*/
+	void 				(*RXC_CallBack)(void);		/*Reception Complete Call Back*/
+}SPI_CONTEXT_t;
+
+/************** End of PRIVATE TYPES *******************/
+
 /***************** STATIC FUNCTIONS ********************/
 
 /*
@@ -24,6 +45,25 @@ static Error_State_t SPI_Check_Configs(const SPI_CONFIGS_t * SPI_Configs);
  * @retval			:	Error State
  */
 static void SPI_IRQ_Source_HANDLE(SPI_SPI_NUMBER_t SPI_Num);
+
+/*
+ * @function 		:	SPI_Next_TX_Element
+ * @brief			:	Private Function To Fetch Next Frame of Byte Buffer , in 16 Bits Mode Two Bytes
+ * 						Are Packed ( First Byte in MSB ) & Odd Last Byte is Padded With SPI_PAD_BYTE
+ * @param			:	Context, Transfer Context of The SPI
+ * @retval			:	Frame to Write in DR
+ */
+static uint16_t SPI_Next_TX_Element(SPI_CONTEXT_t * Context);
+
+/*
+ * @function 		:	SPI_Store_RX_Element
+ * @brief			:	Private Function To Store Received Frame in Byte Buffer , in 16 Bits Mode Frame
+ * 						is Unpacked in Two Bytes & Padding of Odd Length Buffers is Dropped
+ * @param			:	Context, Transfer Context of The SPI
+ * @param			:	Data, Frame Read From DR
+ * @retval			:	void
+ */
+static void SPI_Store_RX_Element(SPI_CONTEXT_t * Context, uint16_t Data);
 /************** End of STATIC FUNCTIONS ****************/
 
 /*****************Private Defines***********************/
@@ -66,6 +106,11 @@ static void SPI_IRQ_Source_HANDLE(SPI_SPI_NUMBER_t SPI_Num);
 
 #define GARBAGE_VALUE			0
 
+/*Elements Written But Not Read Back Yet in Polled Full Duplex ( Holding + Shift Register )*/
+#define SPI_MAX_FRAMES_IN_FLIGHT	2
+
+#define SPI_PAD_BYTE			0x00
+
 #define SPI_MAX_INTERRUPTS		3
 
 #define RXDMAEN_BIT				0
@@ -73,4 +118,6 @@ static void SPI_IRQ_Source_HANDLE(SPI_SPI_NUMBER_t SPI_Num);
 
 #define	SSI_BIT					8
 
+#define CRC_NEXT_BIT			12
+
 #endif /* SPI_INC_SPI_PRIVATE_H_ */
@@ -15,6 +15,13 @@
 #ifndef SYSTICK_INTERFACE_H_
 #define SYSTICK_INTERFACE_H_
 
+/* ======================================================================
+ * SYSTICK Clock
+ * ====================================================================== */
+
+/* AHB Clock ( HSI , No PLL ) in Hz , Set in SYSTICK_TIMER_CONFIG & Used by Upper Layers Counting Core Cycles */
+#define SYSTICK_HCLK_HZ		16000000UL
+
 /* ======================================================================
  * SYSTICK Option Enums
  * ====================================================================== */
@@ -59,6 +66,7 @@ typedef struct
 {
     SYSTICK_EXCEPTION_t Exception;
     SYSTICK_CLK_SOURCE_t CLK;
+    uint32_t HCLK;              /**< AHB Clock Frequency in Hz , All Reload Values Are Derived From it */
 
 } SYSTICK_CONFIG_t;
 
@@ -74,10 +82,9 @@ typedef struct
  * @brief  : Fuction That Makes Delay in Software Based on Passed Number of Milliseconds
  * @param  : Copy_u32TimeInMillis -> Time Passed To Delay in Milliseconds
  * @retval : ErrorStatus To Indicate if Function Worked Correctly or Not
- * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in milliseconds is ( 1000 ms = 1s ) if you want more than this value
- *              you can go with the other configuration ( SYSTICK_AHB_BY8 ) or Just Use ( SYSTICK_AHB ) & Repeat Calling the Function
- *
- *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in milliseconds is ( 8000 ms = 8s )
+ *              -> NOK if Configured Clock is Invalid or Delay is Too Short to Count
+ * @note   : => Delays Longer Than One 24-bit Reload Period ( ~1s With SYSTICK_AHB , ~8s With SYSTICK_AHB_BY8 at 16 MHz )
+ *              Are Chained Over Several Periods , So Any uint32_t Value Works
  **/
 
 ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis) ;
@@ -89,9 +96,8 @@ ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis) ;
  * @brief  : Fuction That Makes Delay in Software Based on Passed Number of MicroSeconds
  * @param  : Copy_u32TimeInMicroSeconds => Time Passed To Delay in MicroSeconds
  * @retval : ErrorStatus To Indicate If Function Worked Properly
- * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in microseconds is ( 1000000 us = 1s ) if you want more than this value
- *
- *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in microseconds is ( 8000000 us = 8s )
+ *              -> NOK if Configured Clock is Invalid or Delay is Too Short to Count
+ * @note   : => Delays Longer Than One 24-bit Reload Period Are Chained Over Several Periods
  **/
 ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds) ;
 
@@ -101,7 +107,9 @@ ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds) ;
  * @parameter[in]	:	the Desired interrupt Time in MS
  * @parameter[in]	:	The Call back function
  * @retval			:	Error State
+ * @note			:	Intervals Beyond The 24-bit Reload Switch AHB to AHB / 8 When Exact , Otherwise The Interval
+ * 						is Split Into Equal Periods & The Call back Runs Once Every Chain of Periods
  */
 
-void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , void (* SYSTK_pfCallBackFunc )(void));
+ERRORS_t	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , void (* SYSTK_pfCallBackFunc )(void));
 #endif /* SYSTICK_INTERFACE_H_ */
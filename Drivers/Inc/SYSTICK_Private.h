@@ -19,8 +19,16 @@
 #ifndef SYSTICK_INC_SYSTICK_PRIVATE_H_
 #define SYSTICK_INC_SYSTICK_PRIVATE_H_
 
-#define AHB_TICK_TIME     0.0625f
-#define AHB_BY8_TICK_TIME 0.5f
+/* SysTick External Reference is AHB / 8 */
+#define AHB_PRESCALER			8UL
+
+#define MS_PER_SECOND			1000UL
+#define US_PER_SECOND			1000000UL
+
+/* 24-bit Down Counter : One Period is RVR + 1 Ticks , RVR of 0 Stops The Counter */
+#define MAX_RELOAD_VALUE		0x00FFFFFFUL
+#define MAX_PERIOD_TICKS		( MAX_RELOAD_VALUE + 1UL )
+#define MIN_PERIOD_TICKS		2UL
 
 #define 	ENABLE_MASK				0b1
 #define 	ENABLE_BIT_ACCESS		0
@@ -31,4 +39,22 @@
 #define		CLKSRC_MASK				0b1
 #define 	CLKSRC_BIT_ACCESS		2u
 
+/**
+ * @fn     : SYSTICK_GetClock
+ * @brief  : Function That Gets SysTick Counting Frequency From Configured HCLK & Clock Source
+ *           After Checking it Against SYST_CALIB
+ * @param  : Copy_u8ClockSource => CLKSOURCE Bit Value ( 0 : AHB / 8 , 1 : AHB )
+ * @param  : Copy_pu32Clock => Pointer to Returned Frequency in Hz
+ * @retval : ErrorStatus To Indicate if Function Worked Correctly or Not
+ **/
+static ERRORS_t SYSTICK_GetClock(uint8_t Copy_u8ClockSource, uint32_t *Copy_pu32Clock);
+
+/**
+ * @fn     : SYSTICK_Wait
+ * @brief  : Fuction That Polls SysTick For a Number of Ticks , Chaining Reload Periods When Ticks Exceed 24-bit
+ * @param  : Copy_u64Ticks => Ticks To Wait ( At Least MIN_PERIOD_TICKS )
+ * @retval : void
+ **/
+static void SYSTICK_Wait(uint64_t Copy_u64Ticks);
+
 #endif /* SYSTICK_INC_SYSTICK_PRIVATE_H_ */
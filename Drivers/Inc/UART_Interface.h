@@ -186,6 +186,14 @@ void UART_voidInterruptConfig(UART_Config_t *UART_Config);
  *@retval u16
  *==============================================================================================================================================*/
 void UART_u16ReceiveIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(void));
+/*==============================================================================================================================================
+ *@fn      : UART_voidReceiveStreamIT
+ *@brief  :  This is a function used to receive every data through UART peripheral using interrupts , Receive Interrupt Stays Enabled
+ *@paramter[in]  : UART_Config_t *UART_Config : Pointer to the UART peripheral configuration structure
+ *@paramter[in]  : pv_CallBackFunc : Called From ISR With Every Received Data , NULL Stops The Stream
+ *@retval void
+ *==============================================================================================================================================*/
+void UART_voidReceiveStreamIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(uint16_t Data));
 /*==============================================================================================================================================
  *@fn    USART_voidRecieveBuffer
  *@brief  This function is used to receive a string through UART peripheral using polling
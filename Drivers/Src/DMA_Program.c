@@ -32,11 +32,60 @@
  * GLOBAL VARIABLES SECTION START
  *==============================================================================================================================================*/
 
-static void (*DMA1_STREAM_PTR_TOFUNC[8][DMA_INT_NUM])(void) = {NULL};
-static void (*DMA2_STREAM_PTR_TOFUNC[8][DMA_INT_NUM])(void) = {NULL};
+/* Call Backs Per Controller , Stream & Interrupt ( @DMA_CALLBACK_ID_t ) */
+static void (*DMA_STREAM_PTR_TOFUNC[2][8][DMA_INT_NUM])(void) = {{{NULL}}};
+
+/* Call Backs Carrying Stream & User Context , Only One of The Two Kinds is Set For an Interrupt */
+static DMA_CONTEXT_CALLBACK_t DMA_STREAM_CONTEXT_TOFUNC[2][8][DMA_INT_NUM] = {{{NULL}}};
+static void *DMA_STREAM_CONTEXT[2][8][DMA_INT_NUM] = {{{NULL}}};
 
 static DMA_RegDef_t *DMA[2] = {DMA1, DMA2};
 
+/* Flag Raising Every Call Back ( Indexed by @DMA_CALLBACK_ID_t ) */
+static const DMA_Interrupt_Flag_t DMA_CALLBACK_FLAG[DMA_INT_NUM] = {TRANSFER_COMPLETE_IT_FLAG, HALF_TRANSFER_IT_FLAG, TRANSFER_ERROR_IT_FLAG, DIRECT_MODE_ERROR_IT_FLAG, FIFO_ERROR_IT_FLAG};
+
+/* Stream Flags Group Position Inside LISR / HISR ( Same in LIFCR / HIFCR ) */
+static const uint8_t DMA_FLAGS_OFFSET[DMA_STREAMS_PER_ISR] = DMA_STREAM_FLAGS_OFFSETS;
+
+/* Streams & Channels Able to Serve Every Request ( Indexed by @DMA_REQUEST_t ) */
+static const uint8_t DMA_REQUEST_MAP[DMA_REQUEST_NUMBER][DMA_MAP_OPTIONS] = {
+    {DMA_REQ_SPI1_RX_OPTION1, DMA_REQ_SPI1_RX_OPTION2},
+    {DMA_REQ_SPI1_TX_OPTION1, DMA_REQ_SPI1_TX_OPTION2},
+    {DMA_REQ_SPI2_RX_OPTION1, DMA_REQ_SPI2_RX_OPTION2},
+    {DMA_REQ_SPI2_TX_OPTION1, DMA_REQ_SPI2_TX_OPTION2},
+    {DMA_REQ_SPI3_RX_OPTION1, DMA_REQ_SPI3_RX_OPTION2},
+    {DMA_REQ_SPI3_TX_OPTION1, DMA_REQ_SPI3_TX_OPTION2},
+    {DMA_REQ_SPI4_RX_OPTION1, DMA_REQ_SPI4_RX_OPTION2},
+    {DMA_REQ_SPI4_TX_OPTION1, DMA_REQ_SPI4_TX_OPTION2},
+    {DMA_REQ_USART1_RX_OPTION1, DMA_REQ_USART1_RX_OPTION2},
+    {DMA_REQ_USART1_TX_OPTION1, DMA_REQ_USART1_TX_OPTION2},
+    {DMA_REQ_USART2_RX_OPTION1, DMA_REQ_USART2_RX_OPTION2},
+    {DMA_REQ_USART2_TX_OPTION1, DMA_REQ_USART2_TX_OPTION2},
+    {DMA_REQ_USART3_RX_OPTION1, DMA_REQ_USART3_RX_OPTION2},
+    {DMA_REQ_USART3_TX_OPTION1, DMA_REQ_USART3_TX_OPTION2},
+    {DMA_REQ_UART4_RX_OPTION1, DMA_REQ_UART4_RX_OPTION2},
+    {DMA_REQ_UART4_TX_OPTION1, DMA_REQ_UART4_TX_OPTION2},
+    {DMA_REQ_UART5_RX_OPTION1, DMA_REQ_UART5_RX_OPTION2},
+    {DMA_REQ_UART5_TX_OPTION1, DMA_REQ_UART5_TX_OPTION2},
+    {DMA_REQ_USART6_RX_OPTION1, DMA_REQ_USART6_RX_OPTION2},
+    {DMA_REQ_USART6_TX_OPTION1, DMA_REQ_USART6_TX_OPTION2},
+    {DMA_REQ_I2C1_RX_OPTION1, DMA_REQ_I2C1_RX_OPTION2},
+    {DMA_REQ_I2C1_TX_OPTION1, DMA_REQ_I2C1_TX_OPTION2},
+    {DMA_REQ_I2C2_RX_OPTION1, DMA_REQ_I2C2_RX_OPTION2},
+    {DMA_REQ_I2C2_TX_OPTION1, DMA_REQ_I2C2_TX_OPTION2},
+    {DMA_REQ_I2C3_RX_OPTION1, DMA_REQ_I2C3_RX_OPTION2},
+    {DMA_REQ_I2C3_TX_OPTION1, DMA_REQ_I2C3_TX_OPTION2},
+    {DMA_REQ_MEM_TO_MEM_OPTION1, DMA_REQ_MEM_TO_MEM_OPTION2},
+};
+
+/* Bit Per Stream Taken by Allocator or Reservation , Per Controller */
+static uint8_t DMA_STREAMS_IN_USE[2] = {0};
+
+/* Descriptor Chains : Next Segment , Segments Left & Increment Bits Configured at Init For Every Stream */
+static const DMA_SEGMENT_t *DMA_CHAIN_NEXT_SEGMENT[2][8] = {{NULL}};
+static volatile uint8_t DMA_CHAIN_SEGMENTS_LEFT[2][8] = {{0}};
+static uint32_t DMA_CHAIN_INC_BITS[2][8] = {{0}};
+
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
  *==============================================================================================================================================*/
@@ -57,11 +106,64 @@ Error_State_t DMA_ClearInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS
 {
 	Error_State_t Local_u8ErrorStatus = DMA_OK;
 
+    if (InterruptFlag < FIFO_ERROR_IT_FLAG || InterruptFlag > TRANSFER_COMPLETE_IT_FLAG)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = DMA_ClearInterruptFlags(DMAController, StreamNumber, (uint8_t)(1 << InterruptFlag));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief : The Function Reads A Specified  Interrupt Flag of A Specified Stream in a Certain DMA Controller of the Two DMA Controllers
+ *
+ * @param : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param : InterruptFlag => Enum that holds All Interrupt Flags that can Generate Interrupt in a Certain Stream -> Check Options ( @DMA_Interrupt_Flags_t )
+ * @param : InterruptFlagStatus => Pointer to a Variable that will hold the Status of the Interrupt Flag -> Check Options ( @DMA_Interrupt_Flag_Status_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ReadInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_Interrupt_Flag_t InterruptFlag, DMA_Interrupt_Flag_Status_t *InterruptFlagStatus)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    uint8_t Local_u8Flags = 0;
+
+    if (InterruptFlag < FIFO_ERROR_IT_FLAG || InterruptFlag > TRANSFER_COMPLETE_IT_FLAG || InterruptFlagStatus == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = DMA_ReadInterruptFlags(DMAController, StreamNumber, &Local_u8Flags);
+
+        *InterruptFlagStatus = ((Local_u8Flags >> InterruptFlag) & 0x01) ? DMA_FLAG_SET : DMA_FLAG_RESET;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief : The Function Reads All Interrupt Flags of A Specified Stream in One Status Register Access
+ *
+ * @param : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param : InterruptFlags => Pointer to a Variable that will hold Raised Flags , Bit ( 1 << Flag ) Per Flag -> Check Options ( @DMA_Interrupt_Flags_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ReadInterruptFlags(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint8_t *InterruptFlags)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    volatile uint32_t *Local_pISR = NULL;
+    volatile uint32_t *Local_pIFCR = NULL;
+
     uint8_t Local_u8RegisterShift = 0;
 
     if (StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 ||
-        InterruptFlag < FIFO_ERROR_IT_FLAG || InterruptFlag > TRANSFER_COMPLETE_IT_FLAG ||
-        DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER)
+        DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER || InterruptFlags == NULL)
     {
         Local_u8ErrorStatus = DMA_NOK;
     }
@@ -69,40 +171,32 @@ Error_State_t DMA_ClearInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS
     {
         /* Configurations Are Correct */
 
-        if (StreamNumber % 2 == 0)
-        {
-            /* Even */
-            Local_u8RegisterShift = 0;
-        }
-        else
-        {
-            /* Odd */
-            Local_u8RegisterShift = 6;
-        }
+        Local_u8RegisterShift = DMA_GetFlagRegisters(DMAController, StreamNumber, &Local_pISR, &Local_pIFCR);
 
-        DMA[DMAController]->IFCR[StreamNumber / 2] = (1 << InterruptFlag << Local_u8RegisterShift);
+        *InterruptFlags = (uint8_t)((*Local_pISR >> Local_u8RegisterShift) & DMA_STREAM_FLAGS_MASK);
     }
     return Local_u8ErrorStatus;
 }
 
 /**
- * @brief : The Function Reads A Specified  Interrupt Flag of A Specified Stream in a Certain DMA Controller of the Two DMA Controllers
+ * @brief : The Function Clears Several Interrupt Flags of A Specified Stream in One Clear Register Access
  *
  * @param : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
  * @param : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
- * @param : InterruptFlag => Enum that holds All Interrupt Flags that can Generate Interrupt in a Certain Stream -> Check Options ( @DMA_Interrupt_Flags_t )
- * @param : InterruptFlagStatus => Pointer to a Variable that will hold the Status of the Interrupt Flag -> Check Options ( @DMA_Interrupt_Flag_Status_t )
+ * @param : InterruptFlags => Flags to Clear , Bit ( 1 << Flag ) Per Flag As Returned by DMA_ReadInterruptFlags
  * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
  */
-Error_State_t DMA_ReadInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_Interrupt_Flag_t InterruptFlag, DMA_Interrupt_Flag_Status_t *InterruptFlagStatus)
+Error_State_t DMA_ClearInterruptFlags(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint8_t InterruptFlags)
 {
 	Error_State_t Local_u8ErrorStatus = DMA_OK;
 
+    volatile uint32_t *Local_pISR = NULL;
+    volatile uint32_t *Local_pIFCR = NULL;
+
     uint8_t Local_u8RegisterShift = 0;
 
     if (StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 ||
-        InterruptFlag < FIFO_ERROR_IT_FLAG || InterruptFlag > TRANSFER_COMPLETE_IT_FLAG ||
-        DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER || InterruptFlagStatus == NULL)
+        DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER)
     {
         Local_u8ErrorStatus = DMA_NOK;
     }
@@ -110,17 +204,10 @@ Error_State_t DMA_ReadInterruptFlag(DMA_CONTROLLER_t DMAController, DMA_STREAMS_
     {
         /* Configurations Are Correct */
 
-        if (StreamNumber % 2 == 0)
-        {
-            /* Even */
-            Local_u8RegisterShift = 0;
-        }
-        else
-        {
-            /* Odd */
-            Local_u8RegisterShift = 6;
-        }
-        *InterruptFlagStatus = ((DMA[DMAController]->ISR[StreamNumber / 2] >> InterruptFlag >> Local_u8RegisterShift) & 0x01);
+        Local_u8RegisterShift = DMA_GetFlagRegisters(DMAController, StreamNumber, &Local_pISR, &Local_pIFCR);
+
+        /* Clear Register is Write 1 to Clear , Other Streams Are Not Touched */
+        *Local_pIFCR = ((uint32_t)(InterruptFlags & DMA_STREAM_FLAGS_MASK) << Local_u8RegisterShift);
     }
     return Local_u8ErrorStatus;
 }
@@ -206,72 +293,94 @@ Error_State_t DMA_Init(DMA_INIT_STRUCT_t *Init)
 {
 	Error_State_t Local_u8ErrorStatus = OK;
 
-    if (DMA_NOK != DMA_CheckInitConfig(Init))
+    DMA_STREAM_CONFIG_t Local_StreamConfig = {0};
+
+    if (DMA_OK == DMA_ComposeConfig(Init, &Local_StreamConfig))
     {
         /* Configuration Are OK */
 
-        /* Make Sure that Stream is Disabled Before Doing Any Configurations */
-        DMA_DisableStream(Init->DMAController, Init->StreamNumber);
-
-        /* Set Channel */
-        DMA_SetChannel(Init->DMAController, Init->StreamNumber, Init->ChannelNumber);
-
-        /* Set Memory Burst */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_MBURST_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->MemBurst << MBURST);
-
-        /* Set Peripheral Burst */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_PBURST_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->PeriphBurst << PBURST);
-
-        /* Set Priority Level */
-        DMA_SetStreamPriority(Init->DMAController, Init->StreamNumber, Init->Priority);
-
-        /* Set Memory Data Size */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_MSIZE_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->MemDataWidth << MSIZE);
-
-        /* Set Peripheral Data Size */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_PSIZE_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->PeriphDataWidth << MSIZE);
-
-        /* Data Transfer Direction */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_DIR_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->Direction << DIR);
-
-        /* Set DMA Mode */
-        /* Circular OR Normal */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_CIRC_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->Mode << CIRC);
-
-        /* Set Double Buffer Mode */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_DBM_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->DoubleBuffer << DBM);
+        /* Whole Stream Configured With One CR Write & One FCR Write */
+        DMA_ApplyConfig(&Local_StreamConfig);
+    }
+    else
+    {
+        /* Configuration Are NOK */
 
-        /* Set Memory Increment Option */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_MINC_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->MemInc << MINC);
+        Local_u8ErrorStatus = DMA_WRONG_CONFIGURATION;
+    }
+    return Local_u8ErrorStatus;
+}
 
-        /* Set Peripheral Increment Option */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR &= (DMA_PINC_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].CR |= (Init->PeriphInc << PINC);
+/**
+ * @brief : This Function Builds The Full CR & FCR Values of a Stream From its Configurations Without Touching The Stream ,
+ *          Keep The Result to Reconfigure The Stream Later With Two Register Writes
+ *
+ * @param : Init => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param : StreamConfig => Pointer to Struct that will hold The Composed Values -> Check Struct ( @DMA_STREAM_CONFIG_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ComposeConfig(const DMA_INIT_STRUCT_t *Init, DMA_STREAM_CONFIG_t *StreamConfig)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
 
-        /* Set Interrupts Configurations Enabled OR Disabled */
-        DMA_EnableIT(Init);
+    if (Init == NULL || StreamConfig == NULL || DMA_NOK == DMA_CheckInitConfig(Init))
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        StreamConfig->DMAController = Init->DMAController;
+        StreamConfig->StreamNumber = Init->StreamNumber;
+
+        /* Channel , Bursts , Priority , Sizes , Increments , Mode , Direction & Interrupts , Stream Left Disabled */
+        StreamConfig->CR = ((uint32_t)Init->ChannelNumber << CHSEL) |
+                           ((uint32_t)Init->MemBurst << MBURST) |
+                           ((uint32_t)Init->PeriphBurst << PBURST) |
+                           ((uint32_t)Init->DoubleBuffer << DBM) |
+                           ((uint32_t)Init->Priority << PL) |
+                           ((uint32_t)Init->MemDataWidth << MSIZE) |
+                           ((uint32_t)Init->PeriphDataWidth << PSIZE) |
+                           ((uint32_t)Init->MemInc << MINC) |
+                           ((uint32_t)Init->PeriphInc << PINC) |
+                           ((uint32_t)Init->Mode << CIRC) |
+                           ((uint32_t)Init->Direction << DIR) |
+                           ((uint32_t)Init->EnableIT.TransferCompleteIT << TCIE) |
+                           ((uint32_t)Init->EnableIT.HalfTransferIT << HTIE) |
+                           ((uint32_t)Init->EnableIT.TransferErrorIT << TEIE) |
+                           ((uint32_t)Init->EnableIT.DirectModeErrorIT << DMEIE);
+
+        /* FIFO Error Interrupt , FIFO Mode & Threshold */
+        StreamConfig->FCR = ((uint32_t)Init->EnableIT.FIFOErrorIT << FEIE) |
+                            ((uint32_t)Init->FIFOMode << DMDIS) |
+                            ((uint32_t)Init->FIFOThreshold << FTH);
+    }
+    return Local_u8ErrorStatus;
+}
 
-        /* FIFO Mode */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR &= (DMA_DMDIS_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR |= (Init->FIFOMode << DMDIS);
+/**
+ * @brief : This Function Disables a Stream & Writes its Composed CR & FCR Values , Each With One Store
+ *
+ * @param : StreamConfig => Composed Values From ( @DMA_ComposeConfig ) -> Check Struct ( @DMA_STREAM_CONFIG_t )
+ * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note  : Stream Keeps These Values Between Transfers , Restarts Only Rewrite Number of Data & Addresses
+ */
+Error_State_t DMA_ApplyConfig(const DMA_STREAM_CONFIG_t *StreamConfig)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
 
-        /* FIFO Threshold Selection */
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR &= (DMA_FTH_MASK);
-        DMA[Init->DMAController]->STREAM[Init->StreamNumber].FCR |= (Init->FIFOThreshold << FTH);
+    if (StreamConfig == NULL ||
+        StreamConfig->DMAController < DMA1_CONTROLLER || StreamConfig->DMAController > DMA2_CONTROLLER ||
+        StreamConfig->StreamNumber < DMA_STREAM0 || StreamConfig->StreamNumber > DMA_STREAM7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
     }
     else
     {
-        /* Configuration Are NOK */
+        /* Make Sure that Stream is Disabled Before Doing Any Configurations */
+        DMA_DisableStream(StreamConfig->DMAController, StreamConfig->StreamNumber);
 
-        Local_u8ErrorStatus = DMA_WRONG_CONFIGURATION;
+        DMA[StreamConfig->DMAController]->STREAM[StreamConfig->StreamNumber].CR = (StreamConfig->CR & DMA_EN_MASK);
+        DMA[StreamConfig->DMAController]->STREAM[StreamConfig->StreamNumber].FCR = StreamConfig->FCR;
     }
     return Local_u8ErrorStatus;
 }
@@ -280,7 +389,7 @@ Error_State_t DMA_Init(DMA_INIT_STRUCT_t *Init)
  * @brief : The Function Configures Interrupt Enabling Or Disabling Of All Interrupts in a Certain Stream in a Certain DMA Controller
  *
  * @param : DMA_InitConfig =>  Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
- * @note  : This Function is Being Called in DMA_Init Function , So No Need to Call it Again Unless You Want to Change Interrupt Configurations
+ * @note  : DMA_Init Already Writes Interrupt Enables , So No Need to Call it Unless You Want to Change Interrupt Configurations
  * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly
  */
 Error_State_t DMA_EnableIT(DMA_INIT_STRUCT_t *DMA_InitConfig)
@@ -342,6 +451,9 @@ Error_State_t DMA_DisableStream(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t Stream
     {
         /* Configurations Are Correct */
 
+        /* Abort Any Running Chain */
+        DMA_CHAIN_SEGMENTS_LEFT[DMANumber][StreamNumber] = 0;
+
         DMA[DMANumber]->STREAM[StreamNumber].CR &= (DMA_EN_MASK);
 
         /* Wait Until Stream is Disabled */
@@ -401,6 +513,202 @@ Error_State_t DMA_StartTransfer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *SrcAddr
     return Local_u8ErrorStatus;
 }
 
+/**
+ * @brief  : This Function Starts a Double Buffer ( Ping Pong ) Stream , DMA Begins With Buffer 0 & Switches to The Other
+ *           Buffer by Itself at Every Transfer Complete , With No Gap & No Restart
+ *
+ * @param  : InitConfig  => Struct that holds all configurations of the DMA , DoubleBuffer Must be Enabled -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : PeriphAddress => Pointer to The Peripheral Data Register
+ * @param  : Buffer0 => Pointer to First Memory Buffer ( M0AR )
+ * @param  : Buffer1 => Pointer to Second Memory Buffer ( M1AR )
+ * @param  : DataLength  => Number of Data Transfers Per Buffer
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Transfer Complete Call Back Fires Every Time a Buffer is Done , Refill it There ( @DMA_GetIdleBuffer )
+ */
+Error_State_t DMA_StartDoubleBuffer(DMA_INIT_STRUCT_t *InitConfig, uint32_t *PeriphAddress, uint32_t *Buffer0, uint32_t *Buffer1, uint16_t DataLength)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    if (DMA_NOK == DMA_CheckInitConfig(InitConfig) || PeriphAddress == NULL || Buffer0 == NULL || Buffer1 == NULL ||
+        InitConfig->DoubleBuffer != DMA_DOUBLE_BUFFER_EN || InitConfig->Direction == DMA_MEM_TO_MEM)
+    {
+        /* Memory to Memory Can't Run in Double Buffer Mode */
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* Both Buffers Have The Same Length */
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].NDTR = DataLength;
+
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].PAR = (uint32_t)PeriphAddress;
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].M0AR = (uint32_t)Buffer0;
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].M1AR = (uint32_t)Buffer1;
+
+        /* Start on Buffer 0 */
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR &= ~(1UL << CT);
+
+        /* Stale Flags Would Fire a Call Back Before Any Buffer is Done */
+        DMA_ClearInterruptFlags(InitConfig->DMAController, InitConfig->StreamNumber, DMA_STREAM_FLAGS_MASK);
+
+        /* Enable Stream */
+        DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR |= (1 << EN);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Reports The Buffer Software Owns Now ( The One DMA is Not Using , From CT Bit )
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : IdleBuffer => Pointer to a Variable that will hold The Idle Buffer -> Check Options ( @DMA_BUFFER_t )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_GetIdleBuffer(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_BUFFER_t *IdleBuffer)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    if (DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER ||
+        StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 || IdleBuffer == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* CT Names The Buffer DMA is Using , Software Owns The Other One */
+        *IdleBuffer = ((DMA[DMAController]->STREAM[StreamNumber].CR >> CT) & 0x01) ? DMA_BUFFER0 : DMA_BUFFER1;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Points The Idle Buffer of a Running Double Buffer Stream to a New Memory Address
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Buffer => Buffer to Change -> Check Options ( @DMA_BUFFER_t )
+ * @param  : Address => Pointer to The New Memory Buffer
+ * @return : ERRORS_t => Error Status ( DMA_NOK if DMA is Currently Using That Buffer )
+ * @note   : Hardware Ignores Writes to The Address Register in Use , So Only The Idle One is Accepted
+ */
+Error_State_t DMA_SetBuffer(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_BUFFER_t Buffer, uint32_t *Address)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    DMA_BUFFER_t Local_IdleBuffer = DMA_BUFFER0;
+
+    if (DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER ||
+        StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 ||
+        Buffer < DMA_BUFFER0 || Buffer > DMA_BUFFER1 || Address == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        DMA_GetIdleBuffer(DMAController, StreamNumber, &Local_IdleBuffer);
+
+        if (((DMA[DMAController]->STREAM[StreamNumber].CR >> EN) & 0x01) && (Buffer != Local_IdleBuffer))
+        {
+            /* DMA is Moving Data From / To That Buffer */
+            Local_u8ErrorStatus = DMA_NOK;
+        }
+        else if (Buffer == DMA_BUFFER0)
+        {
+            DMA[DMAController]->STREAM[StreamNumber].M0AR = (uint32_t)Address;
+        }
+        else
+        {
+            DMA[DMAController]->STREAM[StreamNumber].M1AR = (uint32_t)Address;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Reports Number of Data Transfers a Stream Still Has to Do ( NDTR )
+ *
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Remaining => Pointer to a Variable that will hold Number of Transfers Left
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Length of a Transfer Ended Early by The Peripheral ( Slave Frame Cut by NSS ) is Programmed Length Minus Remaining
+ */
+Error_State_t DMA_GetRemaining(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint16_t *Remaining)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    if (DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER ||
+        StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7 || Remaining == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        *Remaining = (uint16_t)DMA[DMAController]->STREAM[StreamNumber].NDTR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Starts a Chain of Segments on a Stream , Transfer Complete Interrupt of Every Segment
+ *           Programs The Next One , Stream Transfer Complete Call Back is Called Once When Last Segment is Done
+ *
+ * @param  : InitConfig => Struct that holds all configurations of the DMA , Normal Mode With Transfer Complete Interrupt -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : Segments => Array of Segments , Must Stay Valid Till Chain is Done ( Buffers Are Not Copied )
+ * @param  : SegmentsNumber => Number of Segments in The Array
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : A Transfer Error Stops The Chain & Only The Error Call Back is Called
+ */
+Error_State_t DMA_StartChain(DMA_INIT_STRUCT_t *InitConfig, const DMA_SEGMENT_t *Segments, uint8_t SegmentsNumber)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    uint8_t Local_u8Segment = 0;
+
+    if (DMA_NOK == DMA_CheckInitConfig(InitConfig) || Segments == NULL || SegmentsNumber == 0 ||
+        InitConfig->Mode != DMA_NORMAL || InitConfig->DoubleBuffer != DMA_DOUBLE_BUFFER_DIS ||
+        InitConfig->EnableIT.TransferCompleteIT != DMA_INT_ENABLE)
+    {
+        /* Next Segment is Programmed From Transfer Complete Interrupt of a Normal Mode Stream */
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else if (((DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR >> EN) & 0x01) ||
+             (DMA_CHAIN_SEGMENTS_LEFT[InitConfig->DMAController][InitConfig->StreamNumber] != 0))
+    {
+        /* Stream is Still Transferring */
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* Checked Here , Not in The Interrupt */
+        for (Local_u8Segment = 0; Local_u8Segment < SegmentsNumber; Local_u8Segment++)
+        {
+            if (Segments[Local_u8Segment].SrcAddress == NULL || Segments[Local_u8Segment].DestAddress == NULL ||
+                Segments[Local_u8Segment].DataLength == 0)
+            {
+                Local_u8ErrorStatus = DMA_NOK;
+                break;
+            }
+        }
+
+        if (DMA_OK == Local_u8ErrorStatus)
+        {
+            /* Segment Flags Only Remove Increments From What Init Configured */
+            DMA_CHAIN_INC_BITS[InitConfig->DMAController][InitConfig->StreamNumber] =
+                DMA[InitConfig->DMAController]->STREAM[InitConfig->StreamNumber].CR & ((1UL << MINC) | (1UL << PINC));
+
+            DMA_CHAIN_NEXT_SEGMENT[InitConfig->DMAController][InitConfig->StreamNumber] = &Segments[1];
+            DMA_CHAIN_SEGMENTS_LEFT[InitConfig->DMAController][InitConfig->StreamNumber] = SegmentsNumber - 1;
+
+            /* Stale Flags Would Complete The First Segment at Once */
+            DMA_ClearInterruptFlags(InitConfig->DMAController, InitConfig->StreamNumber, DMA_STREAM_FLAGS_MASK);
+
+            DMA_LoadSegment(InitConfig->DMAController, InitConfig->StreamNumber, &Segments[0]);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
 /**
  * @brief  : This Functoin Sets a CallBack Function to a Certain Interrupt
  * @fn     : DMA_SetCallBack
@@ -421,22 +729,201 @@ Error_State_t DMA_SetCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t C
         }
         else
         {
-            switch (InitConfig->DMAController)
-            {
-            case DMA1_CONTROLLER:
-                DMA1_STREAM_PTR_TOFUNC[InitConfig->StreamNumber][CallBackID] = Copy_pvCallBack;
-                break;
+            DMA_STREAM_CONTEXT_TOFUNC[InitConfig->DMAController][InitConfig->StreamNumber][CallBackID] = NULL;
 
-            case DMA2_CONTROLLER:
-                DMA2_STREAM_PTR_TOFUNC[InitConfig->StreamNumber][CallBackID] = Copy_pvCallBack;
-                break;
+            DMA_STREAM_PTR_TOFUNC[InitConfig->DMAController][InitConfig->StreamNumber][CallBackID] = Copy_pvCallBack;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Functoin Sets a CallBack Function That Receives The Stream & a User Context to a Certain Interrupt ,
+ *           So One Function Can Serve Many Streams
+ * @fn     : DMA_SetContextCallBack
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @param  : CallBackID => Enum that holds All Possible Interrupts that can Occur in a Certain Stream -> Check Options ( @DMA_CALLBACK_ID_t )
+ * @param  : Copy_pvCallBack => Pointer to Function that will be Called when the Interrupt Occurs -> Check ( @DMA_CONTEXT_CALLBACK_t )
+ * @param  : Context => User Pointer Passed Back to The Call Back As it is ( May be NULL )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ * @note   : Replaces Call Back Set by ( @DMA_SetCallBack ) For The Same Interrupt & Vice Versa
+ */
+Error_State_t DMA_SetContextCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t CallBackID, DMA_CONTEXT_CALLBACK_t Copy_pvCallBack, void *Context)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    if (DMA_NOK != DMA_CheckInitConfig(InitConfig))
+    {
+        if (CallBackID < DMA_TRANSFER_CMP_CALLBACK || CallBackID > DMA_FIFO_ERROR_CALLBACK || Copy_pvCallBack == NULL)
+        {
+            Local_u8ErrorStatus = DMA_NOK;
+        }
+        else
+        {
+            DMA_STREAM_PTR_TOFUNC[InitConfig->DMAController][InitConfig->StreamNumber][CallBackID] = NULL;
+
+            DMA_STREAM_CONTEXT[InitConfig->DMAController][InitConfig->StreamNumber][CallBackID] = Context;
+            DMA_STREAM_CONTEXT_TOFUNC[InitConfig->DMAController][InitConfig->StreamNumber][CallBackID] = Copy_pvCallBack;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Picks a Free Stream Able to Serve a Request , Marks it Used & Writes Controller ,
+ *           Stream & Channel in The Configuration Structure ( Other Fields Are Not Touched )
+ * @fn     : DMA_AllocateStream
+ * @param  : Request => Peripheral Request to Serve -> Check Options ( @DMA_REQUEST_t )
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @return : ERRORS_t => Error Status ( DMA_WRONG_STREAM if Every Possible Stream is Taken )
+ * @note   : Called at Init , Before DMA_Init
+ */
+Error_State_t DMA_AllocateStream(DMA_REQUEST_t Request, DMA_INIT_STRUCT_t *InitConfig)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_WRONG_STREAM;
+
+    uint8_t Local_u8Option = 0;
+    uint8_t Local_u8Map = DMA_MAP_NONE;
+    int8_t Local_s8Stream = 0;
+
+    uint32_t Local_u32PrimaskState = 0;
+
+    if (Request < DMA_REQ_SPI1_RX || Request >= DMA_REQUEST_NUMBER || InitConfig == NULL)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* Streams May be Allocated From Thread & Interrupt Context */
+        ENTER_CRITICAL(Local_u32PrimaskState);
+
+        if (Request == DMA_REQ_MEM_TO_MEM)
+        {
+            /* Upper Streams Are The Least Wanted by Peripherals */
+            for (Local_s8Stream = DMA_STREAM7; Local_s8Stream >= DMA_STREAM0; Local_s8Stream--)
+            {
+                if (!((DMA_STREAMS_IN_USE[DMA_MEM_TO_MEM_CONTROLLER] >> Local_s8Stream) & 0x01))
+                {
+                    Local_u8Map = DMA_MAP(DMA_MEM_TO_MEM_CONTROLLER, Local_s8Stream, DMA_MEM_TO_MEM_CHANNEL);
+                    break;
+                }
             }
         }
+        else
+        {
+            for (Local_u8Option = 0; Local_u8Option < DMA_MAP_OPTIONS; Local_u8Option++)
+            {
+                if ((DMA_REQUEST_MAP[Request][Local_u8Option] != DMA_MAP_NONE) &&
+                    !((DMA_STREAMS_IN_USE[DMA_MAP_CONTROLLER(DMA_REQUEST_MAP[Request][Local_u8Option])] >> DMA_MAP_STREAM(DMA_REQUEST_MAP[Request][Local_u8Option])) & 0x01))
+                {
+                    Local_u8Map = DMA_REQUEST_MAP[Request][Local_u8Option];
+                    break;
+                }
+            }
+        }
+
+        if (Local_u8Map != DMA_MAP_NONE)
+        {
+            DMA_STREAMS_IN_USE[DMA_MAP_CONTROLLER(Local_u8Map)] |= (1 << DMA_MAP_STREAM(Local_u8Map));
+
+            InitConfig->DMAController = (DMA_CONTROLLER_t)DMA_MAP_CONTROLLER(Local_u8Map);
+            InitConfig->StreamNumber = (DMA_STREAMS_t)DMA_MAP_STREAM(Local_u8Map);
+            InitConfig->ChannelNumber = (DMA_CHANNEL_t)DMA_MAP_CHANNEL(Local_u8Map);
+
+            Local_u8ErrorStatus = DMA_OK;
+        }
+
+        EXIT_CRITICAL(Local_u32PrimaskState);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Claims The Stream Already Written in a Configuration Structure For a Request ,
+ *           So Fixed Configurations & Allocated Ones Never Share a Stream
+ * @fn     : DMA_ReserveStream
+ * @param  : Request => Peripheral Request to Serve -> Check Options ( @DMA_REQUEST_t )
+ * @param  : InitConfig => Struct that holds all configurations of the DMA -> Check Struct ( @DMA_INIT_STRUCT_t )
+ * @return : ERRORS_t => Error Status ( DMA_WRONG_CHANNEL if Mapping is Wrong , DMA_WRONG_STREAM if Stream is Taken )
+ * @note   : Constant Configurations Should Also be Checked by DMA_STATIC_ASSERT_MAPPING
+ */
+Error_State_t DMA_ReserveStream(DMA_REQUEST_t Request, const DMA_INIT_STRUCT_t *InitConfig)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    uint8_t Local_u8Map = DMA_MAP_NONE;
+
+    uint32_t Local_u32PrimaskState = 0;
+
+    if (Request < DMA_REQ_SPI1_RX || Request >= DMA_REQUEST_NUMBER || InitConfig == NULL ||
+        InitConfig->DMAController < DMA1_CONTROLLER || InitConfig->DMAController > DMA2_CONTROLLER ||
+        InitConfig->StreamNumber < DMA_STREAM0 || InitConfig->StreamNumber > DMA_STREAM7 ||
+        InitConfig->ChannelNumber < DMA_CHANNEL0 || InitConfig->ChannelNumber > DMA_CHANNEL7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
     }
     else
+    {
+        Local_u8Map = DMA_MAP(InitConfig->DMAController, InitConfig->StreamNumber, InitConfig->ChannelNumber);
+
+        /* Check The Stream Can Serve The Request */
+        if (((Request == DMA_REQ_MEM_TO_MEM) && (InitConfig->DMAController != DMA_MEM_TO_MEM_CONTROLLER)) ||
+            ((Request != DMA_REQ_MEM_TO_MEM) && (Local_u8Map != DMA_REQUEST_MAP[Request][0]) && (Local_u8Map != DMA_REQUEST_MAP[Request][1])))
+        {
+            Local_u8ErrorStatus = DMA_WRONG_CHANNEL;
+        }
+        else
+        {
+            ENTER_CRITICAL(Local_u32PrimaskState);
+
+            if ((DMA_STREAMS_IN_USE[InitConfig->DMAController] >> InitConfig->StreamNumber) & 0x01)
+            {
+                /* Another Driver Owns it */
+                Local_u8ErrorStatus = DMA_WRONG_STREAM;
+            }
+            else
+            {
+                DMA_STREAMS_IN_USE[InitConfig->DMAController] |= (1 << InitConfig->StreamNumber);
+            }
+
+            EXIT_CRITICAL(Local_u32PrimaskState);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function Gives Back a Stream Taken by DMA_AllocateStream or DMA_ReserveStream
+ * @fn     : DMA_ReleaseStream
+ * @param  : DMAController => Enum that holds Options for Available DMA Controllers we have -> To choose Check enum ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds Options for Available Streams in the DMA Controller -> Check Options ( @DMA_STREAMS_t )
+ * @return : ERRORS_t => Error Status To Indicate if Function Worked Properly
+ */
+Error_State_t DMA_ReleaseStream(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	Error_State_t Local_u8ErrorStatus = DMA_OK;
+
+    uint32_t Local_u32PrimaskState = 0;
+
+    if (DMAController < DMA1_CONTROLLER || DMAController > DMA2_CONTROLLER ||
+        StreamNumber < DMA_STREAM0 || StreamNumber > DMA_STREAM7)
     {
         Local_u8ErrorStatus = DMA_NOK;
     }
+    else
+    {
+        ENTER_CRITICAL(Local_u32PrimaskState);
+        DMA_STREAMS_IN_USE[DMAController] &= ~(1 << StreamNumber);
+        EXIT_CRITICAL(Local_u32PrimaskState);
+    }
     return Local_u8ErrorStatus;
 }
 
@@ -447,7 +934,7 @@ Error_State_t DMA_SetCallBack(DMA_INIT_STRUCT_t *InitConfig, DMA_CALLBACK_ID_t C
  * @note  : This Function is a Private Function , Specified For Driver Use Only
  * @return: ERRORS_t => Error Status To Indicate if Function Worked Properly( DMA_OK ) or Not ( DMA_NOK )
  */
-static Error_State_t DMA_CheckInitConfig(DMA_INIT_STRUCT_t *DMA_InitConfig)
+static Error_State_t DMA_CheckInitConfig(const DMA_INIT_STRUCT_t *DMA_InitConfig)
 {
 	Error_State_t Local_u8ErrorStatus = OK;
 
@@ -464,8 +951,15 @@ static Error_State_t DMA_CheckInitConfig(DMA_INIT_STRUCT_t *DMA_InitConfig)
         DMA_InitConfig->PeriphDataWidth < DMA_PERIPH_DATA_WIDTH_8BITS || DMA_InitConfig->PeriphDataWidth > DMA_PERIPH_DATA_WIDTH_32BITS ||
         DMA_InitConfig->PeriphInc < DMA_PINC_DISABLE || DMA_InitConfig->PeriphInc > DMA_PINC_ENABLE ||
         DMA_InitConfig->Priority < DMA_LOW_PRIORITY || DMA_InitConfig->Priority > DMA_VERY_HIGH_PRIORITY ||
-        DMA_InitConfig->StreamNumber < DMA_STREAM0 || DMA_InitConfig->StreamNumber > DMA_STREAM7)
+        DMA_InitConfig->StreamNumber < DMA_STREAM0 || DMA_InitConfig->StreamNumber > DMA_STREAM7 ||
+        DMA_InitConfig->DoubleBuffer < DMA_DOUBLE_BUFFER_DIS || DMA_InitConfig->DoubleBuffer > DMA_DOUBLE_BUFFER_EN ||
+        DMA_InitConfig->EnableIT.DirectModeErrorIT < DMA_INT_DISABLE || DMA_InitConfig->EnableIT.DirectModeErrorIT > DMA_INT_ENABLE ||
+        DMA_InitConfig->EnableIT.FIFOErrorIT < DMA_INT_DISABLE || DMA_InitConfig->EnableIT.FIFOErrorIT > DMA_INT_ENABLE ||
+        DMA_InitConfig->EnableIT.HalfTransferIT < DMA_INT_DISABLE || DMA_InitConfig->EnableIT.HalfTransferIT > DMA_INT_ENABLE ||
+        DMA_InitConfig->EnableIT.TransferCompleteIT < DMA_INT_DISABLE || DMA_InitConfig->EnableIT.TransferCompleteIT > DMA_INT_ENABLE ||
+        DMA_InitConfig->EnableIT.TransferErrorIT < DMA_INT_DISABLE || DMA_InitConfig->EnableIT.TransferErrorIT > DMA_INT_ENABLE)
     {
+        /* Every Field Lands Unmasked in a Composed Register Value , So All of Them Are Checked */
         Local_u8ErrorStatus = DMA_NOK;
     }
     else
@@ -494,98 +988,131 @@ static Error_State_t DMA_IRQHandler(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t St
     }
     else
     {
-        DMA_Interrupt_Flag_Status_t FlagStatus = DMA_FLAG_RESET;
+        uint8_t Local_u8Flags = 0;
 
-        DMA_ReadInterruptFlag(DMANumber, StreamNumber, TRANSFER_COMPLETE_IT_FLAG, &FlagStatus);
+        uint8_t Local_u8CallBackID = 0;
 
-        if (FlagStatus == DMA_FLAG_SET)
-        {
-            /* Transfer Complete IT Occured */
+        /* One Status Read For Every Pending Flag , Then One Clear of Exactly Those Flags ,
+         * So a Flag Raised Meanwhile is Kept For The Next Interrupt */
+        DMA_ReadInterruptFlags(DMANumber, StreamNumber, &Local_u8Flags);
+        DMA_ClearInterruptFlags(DMANumber, StreamNumber, Local_u8Flags);
 
-            DMA_ClearInterruptFlag(DMANumber, StreamNumber, TRANSFER_COMPLETE_IT_FLAG);
-
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+        if (DMA_CHAIN_SEGMENTS_LEFT[DMANumber][StreamNumber] != 0)
+        {
+            if (Local_u8Flags & DMA_CHAIN_ABORT_FLAGS)
             {
-                DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK]();
+                /* Drop Rest of The Chain , Error Call Backs Report it */
+                DMA_CHAIN_SEGMENTS_LEFT[DMANumber][StreamNumber] = 0;
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if ((Local_u8Flags >> TRANSFER_COMPLETE_IT_FLAG) & 0x01)
             {
-                DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_CMP_CALLBACK]();
-            }
-        }
-
-        DMA_ReadInterruptFlag(DMANumber, StreamNumber, HALF_TRANSFER_IT_FLAG, &FlagStatus);
-
-        if (FlagStatus == DMA_FLAG_SET)
-        {
-            /* Half Transfer IT Occured */
+                /* Next Segment Before Any Call Back , So The Gap is Only This Interrupt Entry */
+                DMA_LoadSegment(DMANumber, StreamNumber, DMA_CHAIN_NEXT_SEGMENT[DMANumber][StreamNumber]);
 
-            DMA_ClearInterruptFlag(DMANumber, StreamNumber, HALF_TRANSFER_IT_FLAG);
+                DMA_CHAIN_NEXT_SEGMENT[DMANumber][StreamNumber]++;
+                DMA_CHAIN_SEGMENTS_LEFT[DMANumber][StreamNumber]--;
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
-            {
-                DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK]();
-            }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
-            {
-                DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_HALF_TRANSFER_CALLBACK]();
+                /* Transfer Complete Call Back is For The Whole Chain */
+                Local_u8Flags &= ~(1U << TRANSFER_COMPLETE_IT_FLAG);
             }
         }
 
-        DMA_ReadInterruptFlag(DMANumber, StreamNumber, TRANSFER_ERROR_IT_FLAG, &FlagStatus);
-
-        if (FlagStatus == DMA_FLAG_SET)
+        /* Transfer Complete First , Then Half Transfer & Errors */
+        for (Local_u8CallBackID = DMA_TRANSFER_CMP_CALLBACK; Local_u8CallBackID < DMA_INT_NUM; Local_u8CallBackID++)
         {
-            /* Transfer Error IT Occured */
-
-            DMA_ClearInterruptFlag(DMANumber, StreamNumber, TRANSFER_ERROR_IT_FLAG);
-
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
+            if (!((Local_u8Flags >> DMA_CALLBACK_FLAG[Local_u8CallBackID]) & 0x01))
+            {
+                /* Interrupt Not Raised */
+            }
+            else if (DMA_STREAM_PTR_TOFUNC[DMANumber][StreamNumber][Local_u8CallBackID] != NULL)
             {
-                DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK]();
+                DMA_STREAM_PTR_TOFUNC[DMANumber][StreamNumber][Local_u8CallBackID]();
             }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
+            else if (DMA_STREAM_CONTEXT_TOFUNC[DMANumber][StreamNumber][Local_u8CallBackID] != NULL)
             {
-                DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_TRANSFER_ERROR_CALLBACK]();
+                DMA_STREAM_CONTEXT_TOFUNC[DMANumber][StreamNumber][Local_u8CallBackID](DMANumber, StreamNumber, (DMA_CALLBACK_ID_t)Local_u8CallBackID,
+                                                                                       DMA_STREAM_CONTEXT[DMANumber][StreamNumber][Local_u8CallBackID]);
             }
         }
-        DMA_ReadInterruptFlag(DMANumber, StreamNumber, DIRECT_MODE_ERROR_IT_FLAG, &FlagStatus);
+    }
+    return Local_u8ErrorStatus;
+}
 
-        if (FlagStatus == DMA_FLAG_SET)
-        {
-            /* Direct Mode Error IT Occured */
+/**
+ * @brief  : This Function Returns The Status Register ( LISR / HISR ) & Clear Register ( LIFCR / HIFCR ) of a Stream
+ *           Together With The Position of The Stream Flags Inside Them
+ *
+ * @param  : DMANumber => Enum that holds All Possible DMA Controllers -> Check Options ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds All Possible Streams -> Check Options ( @DMA_STREAMS_t )
+ * @param  : ISR => Pointer to Status Register Address
+ * @param  : IFCR => Pointer to Clear Register Address
+ * @return : uint8_t => Shift of The Stream Flags Group ( 0 , 6 , 16 or 22 )
+ * @note   : This Function is a Private Function , Specified For Driver Use Only , Arguments Are Already Checked
+ */
+static uint8_t DMA_GetFlagRegisters(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumber, volatile uint32_t **ISR, volatile uint32_t **IFCR)
+{
+    if (StreamNumber < DMA_STREAMS_PER_ISR)
+    {
+        /* Streams 0 ~ 3 */
+        *ISR = &DMA[DMANumber]->LISR;
+        *IFCR = &DMA[DMANumber]->LIFCR;
+    }
+    else
+    {
+        /* Streams 4 ~ 7 */
+        *ISR = &DMA[DMANumber]->HISR;
+        *IFCR = &DMA[DMANumber]->HIFCR;
+    }
+    return DMA_FLAGS_OFFSET[StreamNumber % DMA_STREAMS_PER_ISR];
+}
 
-            DMA_ClearInterruptFlag(DMANumber, StreamNumber, DIRECT_MODE_ERROR_IT_FLAG);
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
-            {
-                DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK]();
-            }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
-            {
-                DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_DIRECT_MODE_ERROR_CALLBACK]();
-            }
-        }
+/**
+ * @brief  : This Function Programs a Chain Segment on a Disabled Stream & Enables it
+ *
+ * @param  : DMANumber => Enum that holds All Possible DMA Controllers -> Check Options ( @DMA_CONTROLLER_t )
+ * @param  : StreamNumber => Enum that holds All Possible Streams -> Check Options ( @DMA_STREAMS_t )
+ * @param  : Segment => Segment to Program -> Check Struct ( @DMA_SEGMENT_t )
+ * @return : void
+ * @note   : This Function is a Private Function , Specified For Driver Use Only , Arguments Are Already Checked
+ */
+static void DMA_LoadSegment(DMA_CONTROLLER_t DMANumber, DMA_STREAMS_t StreamNumber, const DMA_SEGMENT_t *Segment)
+{
+    uint32_t Local_u32IncBits = DMA_CHAIN_INC_BITS[DMANumber][StreamNumber];
 
-        DMA_ReadInterruptFlag(DMANumber, StreamNumber, FIFO_ERROR_IT_FLAG, &FlagStatus);
+    uint8_t Local_u8SrcInc = PINC;
+    uint8_t Local_u8DestInc = MINC;
 
-        if (FlagStatus == DMA_FLAG_SET)
-        {
-            /* FIFO Error IT Occured */
+    /* Set Destination & Source Address According to Data Transfer Direction */
+    if (((DMA[DMANumber]->STREAM[StreamNumber].CR >> DIR) & 0x03) == DMA_MEM_TO_PERIPH)
+    {
+        DMA[DMANumber]->STREAM[StreamNumber].M0AR = (uint32_t)Segment->SrcAddress;
+        DMA[DMANumber]->STREAM[StreamNumber].PAR = (uint32_t)Segment->DestAddress;
 
-            DMA_ClearInterruptFlag(DMANumber, StreamNumber, FIFO_ERROR_IT_FLAG);
+        Local_u8SrcInc = MINC;
+        Local_u8DestInc = PINC;
+    }
+    else
+    {
+        DMA[DMANumber]->STREAM[StreamNumber].PAR = (uint32_t)Segment->SrcAddress;
+        DMA[DMANumber]->STREAM[StreamNumber].M0AR = (uint32_t)Segment->DestAddress;
+    }
 
-            if (DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA1_CONTROLLER)
-            {
-                DMA1_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK]();
-            }
-            else if (DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK] != NULL && DMANumber == DMA2_CONTROLLER)
-            {
-                DMA2_STREAM_PTR_TOFUNC[StreamNumber][DMA_FIFO_ERROR_CALLBACK]();
-            }
-        }
+    if (Segment->Flags & DMA_SEGMENT_FLAG_HOLD_SRC)
+    {
+        Local_u32IncBits &= ~(1UL << Local_u8SrcInc);
     }
-    return Local_u8ErrorStatus;
+    if (Segment->Flags & DMA_SEGMENT_FLAG_HOLD_DEST)
+    {
+        Local_u32IncBits &= ~(1UL << Local_u8DestInc);
+    }
+
+    DMA[DMANumber]->STREAM[StreamNumber].NDTR = Segment->DataLength;
+
+    DMA[DMANumber]->STREAM[StreamNumber].CR = (DMA[DMANumber]->STREAM[StreamNumber].CR & DMA_MINC_MASK & DMA_PINC_MASK) | Local_u32IncBits;
+
+    /* Enable Stream */
+    DMA[DMANumber]->STREAM[StreamNumber].CR |= (1 << EN);
 }
 
 /*==============================================================================================================================================
@@ -604,6 +1131,10 @@ void DMA1_Stream1_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM1);
 }
+void DMA1_Stream2_IRQHandler(void)
+{
+    DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM2);
+}
 void DMA1_Stream3_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM3);
@@ -6,8 +6,8 @@
 
 /******************* MAIN INCLUDES *********************/
 #include <stdint.h>
-#include "../../LIBRARY/STM32F446xx.h"
-#include "../../LIBRARY/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+#include "../../Library/ErrTypes.h"
 
 
 #include "../Inc/SPI_Interface.h"
@@ -19,19 +19,8 @@
 
 static SPI_REG_t * SPIs[MAX_SPIs_NUMBER]={SPI1,SPI2,SPI3,SPI4};
 
-static uint8_t IRQ_Source[MAX_SPIs_NUMBER]={NO_SRC};
-
-/*2D array of USARTs Call back functions*/
-static void (*SPI_pf_CallBackFuncs[MAX_SPIs_NUMBER][SPI_MAX_INTERRUPTS])(void)={NULL};
-
-/*Variable to Save the Data buffer size globally*/
-static uint8_t Global_Data_Size=0;
-
-/*Variable to Save the Data buffer globally*/
-static uint8_t* Global_Data_Buffer=NULL;
-
-/*Variable to Save the Received globally*/
-static uint8_t* Global_Received_Data=NULL;
+/*Transfer Context of Every SPI ( Buffers , Counters , Call Backs )*/
+static SPI_CONTEXT_t SPI_Context[MAX_SPIs_NUMBER]={{NULL,NULL,0,0,NO_SRC,DATA_FRAME_SIZE_8BITS,NULL,NULL}};
 /*******************************************************/
 
 /****************** MAIN FUNCTIONS *********************/
@@ -71,9 +60,13 @@ Error_State_t SPI_Init(const SPI_CONFIGS_t * SPI_Config)
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 &= ~((FRAME_TYPE_MASK)<<FRAME_TYPE_START_BITS);
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 |=  ((SPI_Config->Frame_Type)<<FRAME_TYPE_START_BITS);
 
-		/*6- Set CRC Enable State*/
+		/*6- Set CRC Enable State & Polynomial*/
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 &= ~((CRC_ENABLE_MASK)<<CRC_ENABLE_START_BITS);
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 |=  ((SPI_Config->CRC_State)<<CRC_ENABLE_START_BITS);
+		if ((SPI_Config->CRC_State == CRC_STATE_ENABLED) && (0 != SPI_Config->CRC_Polynomial))
+		{
+			SPIs[SPI_Config->SPI_Num]->SPI_CRCPR = SPI_Config->CRC_Polynomial;
+		}
 
 		/*7- Set Slave Management state*/
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 &= ~((SLAVE_MANAGE_MASK)<<SLAVE_MANAGE_START_BITS);
@@ -86,6 +79,7 @@ Error_State_t SPI_Init(const SPI_CONFIGS_t * SPI_Config)
 		/*9- Set Data Frame SIZE*/
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 &= ~((FRAME_SIZE_MASK)<<FRAME_SIZE_START_BITS);
 		SPIs[SPI_Config->SPI_Num]->SPI_CR1 |=  ((SPI_Config->Frame_Size)<<FRAME_SIZE_START_BITS);
+		SPI_Context[SPI_Config->SPI_Num].Frame_Size = SPI_Config->Frame_Size;
 
 		/*10- Set MultiMaster Ability State if Master*/
 		if (SPI_Config->Chip_Mode == CHIP_MODE_MASTER)
@@ -105,32 +99,38 @@ Error_State_t SPI_Init(const SPI_CONFIGS_t * SPI_Config)
 
 /*
  * @function 		:	SPI_Transmit
- * @brief			:	Transmit Data via SPI
+ * @brief			:	Transmit Data via SPI , Holding Register is Refilled as Soon as TXE is Set
+ * 						& BSY is Waited Only Once After The Last Element
  * @param			:	SPI Number
- * @param			:	pointer to Data Buffer
- * @param 			: 	Data Buffer Size
+ * @param			:	pointer to Data Buffer ( In 16 Bits Mode Bytes Are Packed Two Per Frame )
+ * @param 			: 	Data Buffer Size ( Bytes )
  * @retval			:	Error State
+ * @note			:	Data Received Meanwhile is Dropped & OVR is Cleared Before Returning
  */
-Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint16_t * Data , uint8_t Buffer_Size)
+Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint8_t * Data , uint8_t Buffer_Size)
 {
 	Error_State_t 	Error_State = 	OK	;
-	uint8_t 	  	Counter	  	=	0 	;
-	uint8_t 	 	Flag_State  =	FLAG_RESET 	;
+	SPI_CONTEXT_t	Context		=	{0}	;
 	if (NULL != Data)
 	{
 		if (( SPI_Config->SPI_Num >=SPI_NUMBER1) && ( SPI_Config->SPI_Num <=SPI_NUMBER4))
 		{
+			/*Local context , the polled path packs frames as the interrupt path does*/
+			Context.Tx_Buffer = Data;
+			Context.Buffer_Size = Buffer_Size;
+			Context.Frame_Size = SPI_Context[SPI_Config->SPI_Num].Frame_Size;
+
 			/*Send the Data*/
-			while (Counter < Buffer_Size)
+			while (Context.Counter < Buffer_Size)
 			{
-				while (Flag_State != FLAG_SET)
-				{
-					Flag_State	=	GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR , SPI_FLAGS_TXE);
-				}
-				/*Put Data in DR*/
-				SPIs[SPI_Config->SPI_Num]->SPI_DR = *Data;
-				Counter++;
+				/*Wait till TDR is ready for every frame*/
+				while( ! (GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR,SPI_FLAGS_TXE) ) );
+
+				/*Put next frame in DR (two bytes packed in 16 bits mode)*/
+				SPIs[SPI_Config->SPI_Num]->SPI_DR = SPI_Next_TX_Element(&Context);
 			}
+			/*Wait till last element is shifted out & drop what was received*/
+			SPI_Flush_RX(SPI_Config->SPI_Num);
 		}
 		else {
 			Error_State = SPI_WRONG_SPI_NUMBER;
@@ -149,12 +149,12 @@ Error_State_t SPI_Transmit(const SPI_CONFIGS_t * SPI_Config, uint16_t * Data , u
  * @param			:	Buffer to save Data
  * @param 			: 	Data Buffer Size
  * @retval			:	Error State
+ * @note			:	in Master Mode Clocks Are Streamed Back to Back Through SPI_TransmitReceive
  */
 Error_State_t SPI_Receive(const SPI_CONFIGS_t * SPI_Config, uint16_t * Received_Data ,uint8_t Buffer_Size)
 {
 	Error_State_t 	Error_State = 	OK	;
 	uint8_t 	  	Counter	  	=	0 	;
-	uint8_t 	 	Flag_State  =	FLAG_RESET 	;
 	if (NULL != Received_Data)
 	{
 		if ((SPI_Config->SPI_Num>=SPI_NUMBER1) && (SPI_Config->SPI_Num<=SPI_NUMBER4))
@@ -163,29 +163,17 @@ Error_State_t SPI_Receive(const SPI_CONFIGS_t * SPI_Config, uint16_t * Received_
 			{
 				while (Counter < Buffer_Size)
 				{
-					/*Wait till data is Received*/
-					while (Flag_State != FLAG_SET)
-					{
-						Flag_State	=	GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR , SPI_FLAGS_RXNE);
-					}
+					/*Wait till data is Received for every element*/
+					while( ! (GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR,SPI_FLAGS_RXNE) ) );
+
 					/*Read the Received data*/
 					Received_Data[Counter++] = SPIs[SPI_Config->SPI_Num]->SPI_DR ;
 				}
 			}
 			else if (SPI_Config->Chip_Mode == CHIP_MODE_MASTER)
 			{
-				while (Counter < Buffer_Size)
-				{
-					/* writing garbage in the Tx Buffer to start Receiving*/
-					SPIs[SPI_Config->SPI_Num]->SPI_DR = GARBAGE_VALUE;
-					/*Wait till data is Received*/
-					while (Flag_State != FLAG_SET)
-					{
-						Flag_State	=	GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR , SPI_FLAGS_RXNE);
-					}
-					/*Read the Received data*/
-					Received_Data[Counter++] = SPIs[SPI_Config->SPI_Num]->SPI_DR ;
-				}
+				/*Garbage is clocked out to receive*/
+				Error_State = SPI_TransmitReceive(SPI_Config, NULL, Received_Data, Buffer_Size);
 			}
 			else {
 				Error_State = SPI_WRONG_CHIP_MODE;
@@ -202,6 +190,67 @@ Error_State_t SPI_Receive(const SPI_CONFIGS_t * SPI_Config, uint16_t * Received_
 	return Error_State	;
 }
 
+/*
+ * @function 		:	SPI_TransmitReceive
+ * @brief			:	Full Duplex Block Transfer , TXE & RXNE Are Serviced in The Same Loop So The
+ * 						Holding Register is Refilled While The Previous Element is Still Shifting
+ * @param			:	SPI Number
+ * @param			:	Data to Send ( NULL to Clock Out Garbage )
+ * @param			:	Buffer to save Received Data ( NULL to Drop it )
+ * @param 			: 	Data Buffer Size
+ * @retval			:	Error State
+ * @note			:	BSY is Waited Only Once After The Last Element
+ */
+Error_State_t SPI_TransmitReceive(const SPI_CONFIGS_t * SPI_Config, const uint16_t * Data , uint16_t * Received_Data , uint8_t Buffer_Size)
+{
+	Error_State_t 	Error_State = 	OK	;
+	uint8_t 	  	Tx_Counter 	=	0 	;
+	uint8_t 	  	Rx_Counter 	=	0 	;
+	uint16_t 	  	Element 	=	0 	;
+	SPI_REG_t * 	SPI 		= 	NULL;
+
+	if ((NULL == SPI_Config) || ((NULL == Data) && (NULL == Received_Data)))
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if (( SPI_Config->SPI_Num <SPI_NUMBER1) || ( SPI_Config->SPI_Num >SPI_NUMBER4))
+	{
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	else if (SPI_Config->Transfer_Mode != TRANSFER_MODE_FULL_DUPLEX)
+	{
+		Error_State = SPI_WRONG_TRANSFER_MODE;
+	}
+	else
+	{
+		SPI = SPIs[SPI_Config->SPI_Num];
+
+		while (Rx_Counter < Buffer_Size)
+		{
+			/*Refill DR while at most one element is waiting to be read , a third one would overrun RX*/
+			if ((Tx_Counter < Buffer_Size) && ((uint8_t)(Tx_Counter - Rx_Counter) < SPI_MAX_FRAMES_IN_FLIGHT) && GET_BIT(SPI->SPI_SR,SPI_FLAGS_TXE))
+			{
+				SPI->SPI_DR = (NULL != Data) ? Data[Tx_Counter] : GARBAGE_VALUE;
+				Tx_Counter++;
+			}
+
+			if (GET_BIT(SPI->SPI_SR,SPI_FLAGS_RXNE))
+			{
+				Element = SPI->SPI_DR;
+				if (NULL != Received_Data)
+				{
+					Received_Data[Rx_Counter] = Element;
+				}
+				Rx_Counter++;
+			}
+		}
+
+		/*Last element is received , wait once for the bus to go idle*/
+		while( GET_BIT(SPI->SPI_SR,SPI_FLAGS_BSY) );
+	}
+	return Error_State	;
+}
+
 /*
  * @function 		:	SPI_Transmit_IT
  * @brief			:	Transmit Data via SPI and
@@ -217,29 +266,38 @@ Error_State_t SPI_Transmit_IT(const SPI_CONFIGS_t * SPI_Config, uint8_t * Data ,
 	Error_State_t 	Error_State = 	OK	;
 	if ((NULL != Data) && (NULL != SPI_TXC_CallBackFunc))
 	{
-		if (( SPI_Config->SPI_Num >=SPI_NUMBER1) && ( SPI_Config->SPI_Num <=SPI_NUMBER2))
+		if (( SPI_Config->SPI_Num >=SPI_NUMBER1) && ( SPI_Config->SPI_Num <=SPI_NUMBER4))
 		{
-			/*Set IRQ Source*/
-			IRQ_Source[SPI_Config->SPI_Num] = SOURCE_TX;
+			if (SPI_Context[SPI_Config->SPI_Num].IRQ_Source == NO_SRC)
+			{
+				/*Set Call Back in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].TXC_CallBack = SPI_TXC_CallBackFunc ;
 
-			/*Set Call Back Globally*/
-			SPI_pf_CallBackFuncs[SPI_Config->SPI_Num][SPI_FLAGS_TXE]= SPI_TXC_CallBackFunc ;
+				/*Set data to be sent in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].Tx_Buffer = Data ;
 
-			/*Set data to be sent globally*/
-			Global_Data_Buffer = Data ;
+				/*Set Buffer Size in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].Buffer_Size = Buffer_Size;
 
-			/*Set Buffer Size Globally*/
-			Global_Data_Size   = Buffer_Size;
+				/*Nothing Sent Yet*/
+				SPI_Context[SPI_Config->SPI_Num].Counter = 0;
 
-			/*wait till TDR is ready*/
-			while( ! (GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR,SPI_FLAGS_TXE) ) );
+				/*Set IRQ Source*/
+				SPI_Context[SPI_Config->SPI_Num].IRQ_Source = SOURCE_TX;
 
-			/*Put First Data in DR*/
-			SPIs[SPI_Config->SPI_Num]->SPI_DR = Data[0];
+				/*wait till TDR is ready*/
+				while( ! (GET_BIT(SPIs[SPI_Config->SPI_Num]->SPI_SR,SPI_FLAGS_TXE) ) );
 
-			/*Enable Transmission complete interrupt*/
-			SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_TXEIE));
+				/*Put First Data in DR*/
+				SPIs[SPI_Config->SPI_Num]->SPI_DR = SPI_Next_TX_Element(&SPI_Context[SPI_Config->SPI_Num]);
 
+				/*Enable Transmission complete interrupt*/
+				SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_TXEIE));
+			}
+			else {
+				/*Another Transfer is Running on This SPI*/
+				Error_State = SPI_BUSY;
+			}
 		}
 		else {
 			Error_State = SPI_WRONG_SPI_NUMBER;
@@ -266,35 +324,46 @@ Error_State_t SPI_Receive_IT(const SPI_CONFIGS_t * SPI_Config, uint8_t * Receive
 	Error_State_t 	Error_State = 	OK	;
 	if ((NULL != Received_Data) && (NULL != SPI_RXC_CallBackFunc))
 	{
-		if (( SPI_Config->SPI_Num >=SPI_NUMBER1) && ( SPI_Config->SPI_Num <=SPI_NUMBER2))
+		if (( SPI_Config->SPI_Num >=SPI_NUMBER1) && ( SPI_Config->SPI_Num <=SPI_NUMBER4))
 		{
-			/*Set Call Back Globally*/
-			SPI_pf_CallBackFuncs[SPI_Config->SPI_Num][SPI_FLAGS_RXNE]= SPI_RXC_CallBackFunc ;
+			if (SPI_Context[SPI_Config->SPI_Num].IRQ_Source != NO_SRC)
+			{
+				/*Another Transfer is Running on This SPI*/
+				Error_State = SPI_BUSY;
+			}
+			else if ((SPI_Config->Chip_Mode == CHIP_MODE_SLAVE) || (SPI_Config->Chip_Mode == CHIP_MODE_MASTER))
+			{
+				/*Set Call Back in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].RXC_CallBack = SPI_RXC_CallBackFunc ;
 
-			/*Set data to be RECEIVED globally*/
-			Global_Received_Data = Received_Data ;
+				/*Set data to be RECEIVED in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].Rx_Buffer = Received_Data ;
 
-			/*Set Buffer Size Globally*/
-			Global_Data_Size   = Buffer_Size;
+				/*Set Buffer Size in SPI Context*/
+				SPI_Context[SPI_Config->SPI_Num].Buffer_Size = Buffer_Size;
 
-			if (SPI_Config->Chip_Mode == CHIP_MODE_SLAVE)
-			{
-				/*Set IRQ Source*/
-				IRQ_Source[SPI_Config->SPI_Num] = SOURCE_RX_SLAVE;
+				/*Nothing Received Yet*/
+				SPI_Context[SPI_Config->SPI_Num].Counter = 0;
+
+				if (SPI_Config->Chip_Mode == CHIP_MODE_SLAVE)
+				{
+					/*Set IRQ Source*/
+					SPI_Context[SPI_Config->SPI_Num].IRQ_Source = SOURCE_RX_SLAVE;
 
-				/*Enable Receive complete Interrupt*/
-				SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_RXNEIE));
+					/*Enable Receive complete Interrupt*/
+					SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_RXNEIE));
 
-			}
-			else if (SPI_Config->Chip_Mode == CHIP_MODE_MASTER)
-			{
-				/*Set IRQ Source*/
-				IRQ_Source[SPI_Config->SPI_Num] = SOURCE_RX_MASTER;
-				/* writing garbage in the Tx Buffer to start Receiving*/
-				SPIs[SPI_Config->SPI_Num]->SPI_DR = GARBAGE_VALUE;
+				}
+				else
+				{
+					/*Set IRQ Source*/
+					SPI_Context[SPI_Config->SPI_Num].IRQ_Source = SOURCE_RX_MASTER;
+					/* writing garbage in the Tx Buffer to start Receiving*/
+					SPIs[SPI_Config->SPI_Num]->SPI_DR = GARBAGE_VALUE;
 
-				/*Enable Receive complete Interrupt*/
-				SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_RXNEIE));
+					/*Enable Receive complete Interrupt*/
+					SPIs[SPI_Config->SPI_Num]->SPI_CR2 |= (1<<(SPI_INTERRUPT_RXNEIE));
+				}
 			}
 			else {
 				Error_State = SPI_WRONG_CHIP_MODE;
@@ -312,6 +381,75 @@ Error_State_t SPI_Receive_IT(const SPI_CONFIGS_t * SPI_Config, uint8_t * Receive
 
 }
 
+/*
+ * @function 		:	SPI_Slave_Start_Frame
+ * @brief			:	Arm Slave For One NSS Framed Transaction , Elements Are Drained From DR by
+ * 						The Caller RX DMA Stream ( SPI_Enable_DMA_RX ) Till NSS Rises
+ * @param			:	SPI NUMBER
+ * @param			:	Reply , First Element Clocked Out to Master
+ * @retval			:	Error State
+ */
+Error_State_t SPI_Slave_Start_Frame(SPI_SPI_NUMBER_t SPI_Num, uint8_t Reply)
+{
+	Error_State_t 	Error_State = 	OK	;
+
+	if (( SPI_Num >=SPI_NUMBER1) && ( SPI_Num <=SPI_NUMBER4))
+	{
+		if (SPI_Context[SPI_Num].IRQ_Source != NO_SRC)
+		{
+			/*Another Transfer is Running on This SPI*/
+			Error_State = SPI_BUSY;
+		}
+		else
+		{
+			/*Reply waits in DR till master clocks the first element*/
+			SPIs[SPI_Num]->SPI_DR = Reply;
+		}
+	}
+	else {
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	return Error_State	;
+}
+
+/*
+ * @function 		:	SPI_Slave_End_Frame
+ * @brief			:	Close NSS Framed Slave Reception , Reports Overrun ( an Element Lost Because DR
+ * 						Was Not Drained in Time ) & Resyncs The Slave For The Next Frame
+ * @param			:	SPI NUMBER
+ * @param			:	Pointer to Overrun Flag State ( FLAG_SET / FLAG_RESET )
+ * @retval			:	Error State
+ * @note			:	Called From NSS Rising Edge ( EXTI ) Handler Once RX DMA Stream is Stopped
+ */
+Error_State_t SPI_Slave_End_Frame(SPI_SPI_NUMBER_t SPI_Num, uint8_t * Overrun)
+{
+	Error_State_t Error_State = OK;
+	volatile uint16_t Dummy = 0;
+
+	if (NULL == Overrun)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (( SPI_Num >=SPI_NUMBER1) && ( SPI_Num <=SPI_NUMBER4))
+	{
+		*Overrun = GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_OVR);
+
+		/*NSS doesn't reset the slave bit counter , toggling SPE does after a cut frame*/
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1)<<SPI_ENABLE_BIT_START);
+
+		/*Drop element DMA left behind & clear OVR (read DR then SR)*/
+		Dummy = SPIs[SPI_Num]->SPI_DR;
+		Dummy = SPIs[SPI_Num]->SPI_SR;
+		(void)Dummy;
+
+		SPIs[SPI_Num]->SPI_CR1 |=  ((1)<<SPI_ENABLE_BIT_START);
+	}
+	else {
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	return Error_State ;
+}
+
 /*
  * @function 		:	SPI_Enable_DMA_RX
  * @brief			:	Enable DMA Line for SPI Receiving
@@ -384,6 +522,160 @@ Error_State_t SPI_SET_Internal_Slave_State(SPI_SPI_NUMBER_t SPI_Num, SLAVE_STATE
 	}
 	return Error_State ;
 }
+/*
+ * @function 		:	SPI_Flush_RX
+ * @brief			:	Wait Till SPI is Idle & Drop Stale Received Data ( Clears OVR )
+ * @param			:	SPI NUMBER
+ * @retval			:	Error State
+ * @note			:	Needed Before Polled Reception That Follows a Transmit Only ( DMA ) Transfer
+ */
+Error_State_t SPI_Flush_RX(SPI_SPI_NUMBER_t SPI_Num)
+{
+	Error_State_t Error_State = OK;
+	volatile uint16_t Dummy = 0;
+
+	if (( SPI_Num >=SPI_NUMBER1) && ( SPI_Num <=SPI_NUMBER4))
+	{
+		/*Wait till last frame (and its CRC) is shifted out*/
+		while( ! (GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_TXE) ) );
+		while( GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_BSY) );
+
+		/*Drop stale data & clear OVR (read DR then SR)*/
+		Dummy = SPIs[SPI_Num]->SPI_DR;
+		Dummy = SPIs[SPI_Num]->SPI_SR;
+		(void)Dummy;
+	}
+	else {
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	SPI_Reset_CRC
+ * @brief			:	Wait Till SPI is Idle , Drop Stale Received Data & Restart CRC Calculation
+ * @param			:	SPI NUMBER
+ * @retval			:	Error State
+ * @note			:	SPI is Disabled For a Moment But NSS Pin is Not Driven ( Software Slave Management ,
+ * 						SSOE Off ) , Caller Ends The Slave Transaction Through its Chip Select Line
+ */
+Error_State_t SPI_Reset_CRC(SPI_SPI_NUMBER_t SPI_Num)
+{
+	Error_State_t Error_State = OK;
+
+	if (( SPI_Num >=SPI_NUMBER1) && ( SPI_Num <=SPI_NUMBER4))
+	{
+		/*Frame must be out before SPI is disabled*/
+		SPI_Flush_RX(SPI_Num);
+
+		/*CRC registers are cleared only by toggling CRCEN while SPI is disabled*/
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1)<<SPI_ENABLE_BIT_START);
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1<<CRC_NEXT_BIT)|((CRC_ENABLE_MASK)<<CRC_ENABLE_START_BITS));
+		SPIs[SPI_Num]->SPI_CR1 |=  ((CRC_ENABLE_MASK)<<CRC_ENABLE_START_BITS);
+		SPIs[SPI_Num]->SPI_CR1 |=  ((1)<<SPI_ENABLE_BIT_START);
+	}
+	else {
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	SPI_Get_CRC_Error
+ * @brief			:	Read & Clear CRC Error Flag ( Received CRC Mismatch )
+ * @param			:	SPI NUMBER
+ * @param			:	Pointer to Flag State ( FLAG_SET / FLAG_RESET )
+ * @retval			:	Error State
+ */
+Error_State_t SPI_Get_CRC_Error(SPI_SPI_NUMBER_t SPI_Num, uint8_t * CRC_Error)
+{
+	Error_State_t Error_State = OK;
+
+	if (NULL == CRC_Error)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (( SPI_Num >=SPI_NUMBER1) && ( SPI_Num <=SPI_NUMBER4))
+	{
+		*CRC_Error = GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_CRCERR);
+
+		/*CRCERR is cleared by writing 0*/
+		SPIs[SPI_Num]->SPI_SR &= ~(1<<SPI_FLAGS_CRCERR);
+	}
+	else {
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	SPI_Set_BaudRate
+ * @brief			:	Change Master Baud Rate Prescaler at Run Time
+ * @param			:	SPI NUMBER
+ * @param			:	New Baud Rate Prescaler
+ * @retval			:	Error State
+ * @note			:	Waits Till Current Frame is Shifted Out , BR Bits Can't be Changed While SPI is Enabled
+ */
+Error_State_t SPI_Set_BaudRate(SPI_SPI_NUMBER_t SPI_Num, SPI_BAUDRATE_VALUES_t BaudRate_Value)
+{
+	Error_State_t Error_State = OK;
+
+	if (( SPI_Num <SPI_NUMBER1) || ( SPI_Num >SPI_NUMBER4))
+	{
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	else if ((BaudRate_Value < BAUDRATE_FpclkBY2) || (BaudRate_Value > BAUDRATE_FpclkBY256))
+	{
+		Error_State = SPI_WRONG_BAUDRATE;
+	}
+	else
+	{
+		/*Wait till last frame is shifted out*/
+		while( ! (GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_TXE) ) );
+		while( GET_BIT(SPIs[SPI_Num]->SPI_SR,SPI_FLAGS_BSY) );
+
+		/*BR bits are written while SPI is disabled*/
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1)<<SPI_ENABLE_BIT_START);
+		SPIs[SPI_Num]->SPI_CR1 &= ~((BAUD_RATE_MASK)<<BAUD_RATE_START_BITS);
+		SPIs[SPI_Num]->SPI_CR1 |=  ((BaudRate_Value)<<BAUD_RATE_START_BITS);
+		SPIs[SPI_Num]->SPI_CR1 |=  ((1)<<SPI_ENABLE_BIT_START);
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	SPI_Set_CRC_State
+ * @brief			:	Turn Hardware CRC On or Off at Run Time , CRC Calculation Restarts Either Way
+ * @param			:	SPI NUMBER
+ * @param			:	New CRC State
+ * @retval			:	Error State
+ * @note			:	Waits Till Current Frame is Shifted Out , CRCEN Can't be Changed While SPI is Enabled
+ */
+Error_State_t SPI_Set_CRC_State(SPI_SPI_NUMBER_t SPI_Num, SPI_CRC_STATE_t CRC_State)
+{
+	Error_State_t Error_State = OK;
+
+	if (( SPI_Num <SPI_NUMBER1) || ( SPI_Num >SPI_NUMBER4))
+	{
+		Error_State = SPI_WRONG_SPI_NUMBER;
+	}
+	else if ((CRC_State != CRC_STATE_DISABLED) && (CRC_State != CRC_STATE_ENABLED))
+	{
+		Error_State = SPI_WRONG_CRC_STATE;
+	}
+	else
+	{
+		/*Frame must be out before SPI is disabled*/
+		SPI_Flush_RX(SPI_Num);
+
+		/*Clearing CRCEN also clears CRC registers*/
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1)<<SPI_ENABLE_BIT_START);
+		SPIs[SPI_Num]->SPI_CR1 &= ~((1<<CRC_NEXT_BIT)|((CRC_ENABLE_MASK)<<CRC_ENABLE_START_BITS));
+		SPIs[SPI_Num]->SPI_CR1 |=  ((CRC_State)<<CRC_ENABLE_START_BITS);
+		SPIs[SPI_Num]->SPI_CR1 |=  ((1)<<SPI_ENABLE_BIT_START);
+	}
+	return Error_State ;
+}
 
 /***************End of MAIN FUNCTIONS*******************/
 
@@ -483,94 +775,123 @@ static Error_State_t SPI_Check_Configs(const SPI_CONFIGS_t * SPI_Configs)
  */
 static void SPI_IRQ_Source_HANDLE(SPI_SPI_NUMBER_t SPI_Num)
 {
+	/*Context of the SPI That Raised the IRQ*/
+	SPI_CONTEXT_t * Context = &SPI_Context[SPI_Num];
 
-	if (IRQ_Source[SPI_Num] == SOURCE_TX)
+	if (Context->IRQ_Source == SOURCE_TX)
 	{
-		static uint16_t Counter=1;
 		/*Complete buffer Transmission is done*/
-		if (Counter == Global_Data_Size)
+		if (Context->Counter >= Context->Buffer_Size)
 		{
 			/*Disable the TC interrupt*/
 			SPIs[SPI_Num]->SPI_CR2 &= ~(1<<(SPI_INTERRUPT_TXEIE));
 
 			/*Clear IRQ Source*/
-			IRQ_Source[SPI_Num] = NO_SRC;
+			Context->IRQ_Source = NO_SRC;
 
 			/*Call The call Back Function*/
-			SPI_pf_CallBackFuncs[SPI_Num][SPI_FLAGS_TXE]();
-
-			Counter = 1 ;
+			Context->TXC_CallBack();
 		}
 
 		/*Buffer isn't completely sent*/
 		else {
 			/*Send the next data element in the buffer*/
-			SPIs[SPI_Num]->SPI_DR = Global_Data_Buffer[Counter++];
+			SPIs[SPI_Num]->SPI_DR = SPI_Next_TX_Element(Context);
 		}
 	}
-	else if (IRQ_Source[SPI_Num] == SOURCE_RX_SLAVE)
+	else if (Context->IRQ_Source == SOURCE_RX_SLAVE)
 	{
-		static uint16_t Counter=0;
+		/*Every RXNE carries an element , store it first*/
+		SPI_Store_RX_Element(Context, SPIs[SPI_Num]->SPI_DR);
+
 		/*Whole buffer Receiving is done*/
-		if (Global_Data_Size==1)
+		if (Context->Counter >= Context->Buffer_Size)
 		{
 			/*Disable the RXC interrupt*/
 			SPIs[SPI_Num]->SPI_CR2 &= ~(1<<(SPI_INTERRUPT_RXNEIE));
 
 			/*Clear IRQ Source*/
-			IRQ_Source[SPI_Num] = NO_SRC;
-
-			/*Receive the next data element*/
-			Global_Received_Data[Counter++] = SPIs[SPI_Num]->SPI_DR;
+			Context->IRQ_Source = NO_SRC;
 
 			/*Call The call Back Function*/
-			SPI_pf_CallBackFuncs[SPI_Num][SPI_FLAGS_RXNE]();
-
-			Counter = 0 ;
-
-		}
-		else
-		{
-			if (Counter == Global_Data_Size)
-			{
-				/*Disable the RXC interrupt*/
-				SPIs[SPI_Num]->SPI_CR2 &= ~(1<<(SPI_INTERRUPT_RXNEIE));
-
-				/*Clear IRQ Source*/
-				IRQ_Source[SPI_Num] = NO_SRC;
-
-				/*Call The call Back Function*/
-				SPI_pf_CallBackFuncs[SPI_Num][SPI_FLAGS_RXNE]();
-			}
-			else {
-				/*Receive the next data element*/
-				Global_Received_Data[Counter++] = SPIs[SPI_Num]->SPI_DR;
-			}
+			Context->RXC_CallBack();
 		}
 	}
-	else if (IRQ_Source[SPI_Num] == SOURCE_RX_MASTER)
+	else if (Context->IRQ_Source == SOURCE_RX_MASTER)
 	{
-		static uint16_t Counter=0;
+		/*Receive the data element clocked by the last garbage*/
+		SPI_Store_RX_Element(Context, SPIs[SPI_Num]->SPI_DR);
+
 		/*Whole buffer Receiving is done*/
-		if (Counter == Global_Data_Size)
+		if (Context->Counter >= Context->Buffer_Size)
 		{
 			/*Disable the RXC interrupt*/
 			SPIs[SPI_Num]->SPI_CR2 &= ~(1<<(SPI_INTERRUPT_RXNEIE));
 
 			/*Clear IRQ Source*/
-			IRQ_Source[SPI_Num] = NO_SRC;
+			Context->IRQ_Source = NO_SRC;
 
 			/*Call The call Back Function*/
-			SPI_pf_CallBackFuncs[SPI_Num][SPI_FLAGS_RXNE]();
+			Context->RXC_CallBack();
 		}
 		else {
-
-			/* writing garbage in the Tx Buffer to start Receiving*/
+			/* writing garbage in the Tx Buffer to clock the next element*/
 			SPIs[SPI_Num]->SPI_DR = GARBAGE_VALUE;
+		}
+	}
+}
 
-			/*Receive the next data element*/
-			Global_Received_Data[Counter++] = SPIs[SPI_Num]->SPI_DR;
+/*
+ * @function 		:	SPI_Next_TX_Element
+ * @brief			:	Private Function To Fetch Next Frame of Byte Buffer , in 16 Bits Mode Two Bytes
+ * 						Are Packed ( First Byte in MSB ) & Odd Last Byte is Padded With SPI_PAD_BYTE
+ * @param			:	Context, Transfer Context of The SPI
+ * @retval			:	Frame to Write in DR
+ */
+static uint16_t SPI_Next_TX_Element(SPI_CONTEXT_t * Context)
+{
+	uint16_t Element = Context->Tx_Buffer[Context->Counter++];
+
+	if (Context->Frame_Size == DATA_FRAME_SIZE_16BITS)
+	{
+		/*First byte goes out first (MSB first on the wire)*/
+		Element <<= 8;
+
+		if (Context->Counter < Context->Buffer_Size)
+		{
+			Element |= Context->Tx_Buffer[Context->Counter++];
 		}
+		else
+		{
+			/*Odd length , pad the last frame*/
+			Element |= SPI_PAD_BYTE;
+		}
+	}
+	return Element;
+}
+
+/*
+ * @function 		:	SPI_Store_RX_Element
+ * @brief			:	Private Function To Store Received Frame in Byte Buffer , in 16 Bits Mode Frame
+ * 						is Unpacked in Two Bytes & Padding of Odd Length Buffers is Dropped
+ * @param			:	Context, Transfer Context of The SPI
+ * @param			:	Data, Frame Read From DR
+ * @retval			:	void
+ */
+static void SPI_Store_RX_Element(SPI_CONTEXT_t * Context, uint16_t Data)
+{
+	if (Context->Frame_Size == DATA_FRAME_SIZE_16BITS)
+	{
+		Context->Rx_Buffer[Context->Counter++] = (uint8_t)(Data >> 8);
+
+		if (Context->Counter < Context->Buffer_Size)
+		{
+			Context->Rx_Buffer[Context->Counter++] = (uint8_t)Data;
+		}
+	}
+	else
+	{
+		Context->Rx_Buffer[Context->Counter++] = (uint8_t)Data;
 	}
 }
 /************** End of STATIC FUNCTIONS ****************/
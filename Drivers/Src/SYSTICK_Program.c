@@ -37,6 +37,10 @@
 extern SYSTICK_CONFIG_t SYSTICK_TIMER_CONFIG ;
 
 static void (* SYSTK_GpfCallBackFunc )(void)= NULL ;
+
+/* Interrupts Per Call Back When an Interval is Chained Over Several Reload Periods */
+static volatile uint32_t SYSTK_Gu32ChainPeriods = 1 ;
+static volatile uint32_t SYSTK_Gu32ChainCount = 0 ;
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
  *==============================================================================================================================================*/
@@ -51,55 +55,36 @@ static void (* SYSTK_GpfCallBackFunc )(void)= NULL ;
  * @brief  : Fuction That Makes Delay in Software Based on Passed Number of Milliseconds
  * @param  : Copy_u32TimeInMillis -> Time Passed To Delay in Milliseconds
  * @retval : ErrorStatus To Indicate if Function Worked Correctly or Not
- * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in milliseconds is ( 1000 ms = 1s ) if you want more than this value
- *              you can go with the other configuration ( SYSTICK_AHB_BY8 ) or Just Use ( SYSTICK_AHB ) & Repeat Calling the Function
- *
- *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in milliseconds is ( 8000 ms = 8s )
+ *              -> NOK if Configured Clock is Invalid or Delay is Too Short to Count
+ * @note   : => Delays Longer Than One 24-bit Reload Period ( ~1s With SYSTICK_AHB , ~8s With SYSTICK_AHB_BY8 at 16 MHz )
+ *              Are Chained Over Several Periods , So Any uint32_t Value Works
  **/
 
 ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis)
 {
 	ERRORS_t Local_u8ErrorStatus = OK ;
 
-	/* Variable To Carry RELOAD Value */
-	uint32_t RELOAD_Value = 0 ;
-
-	/* Check on TIMER_CLK  */
-	if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMillis * 1000UL ) / AHB_TICK_TIME ;
-	}
-	else if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB_BY8 )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMillis * 1000UL ) / AHB_BY8_TICK_TIME ;
-	}
-	else
-	{
-		Local_u8ErrorStatus = NOK ;
-	}
-
-	/* Setting Reload Value */
-	( SYSTICK->SYST_RVR ) = RELOAD_Value ;
+	/* Variable To Carry SysTick Clock */
+	uint32_t Local_u32Clock = 0 ;
 
-	/* Clear Current */
-	( SYSTICK->SYST_CVR ) = 0 ;
+	/* Variable To Carry Number of Ticks ( 64-bit So Clock * Time Never Overflows ) */
+	uint64_t Local_u64Ticks = 0 ;
 
-	/* Set Exception */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
+	Local_u8ErrorStatus = SYSTICK_GetClock( SYSTICK_TIMER_CONFIG.CLK , &Local_u32Clock ) ;
 
-	/* Set Clock Source */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
-
-	/* Enable Timer */
-	( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
-
-	/* Check on Flag */
-	while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
+	if( Local_u8ErrorStatus == OK )
+	{
+		Local_u64Ticks = ( (uint64_t)Local_u32Clock * Copy_u32TimeInMillis ) / MS_PER_SECOND ;
 
-	/* Disable Timer */
-	( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
+		if( Local_u64Ticks >= MIN_PERIOD_TICKS )
+		{
+			SYSTICK_Wait( Local_u64Ticks ) ;
+		}
+		else
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+	}
 
 	return Local_u8ErrorStatus ;
 }
@@ -110,49 +95,34 @@ ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis)
  * @brief  : Fuction That Makes Delay in Software Based on Passed Number of MicroSeconds
  * @param  : Copy_u32TimeInMicroSeconds => Time Passed To Delay in MicroSeconds
  * @retval : ErrorStatus To Indicate If Function Worked Properly
- * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in microseconds is ( 1000000 us = 1s ) if you want more than this value
- *
- *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in microseconds is ( 8000000 us = 8s )
+ *              -> NOK if Configured Clock is Invalid or Delay is Too Short to Count
+ * @note   : => Delays Longer Than One 24-bit Reload Period Are Chained Over Several Periods
  **/
 ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds)
 {
 	ERRORS_t Local_u8ErrorStatus = OK ;
 
-	/* Variable To Carry RELOAD Value */
-	uint32_t RELOAD_Value = 0 ;
-
-	/* Check on TIMER_CLK  */
-	if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMicroSeconds  / AHB_TICK_TIME ) ;
-	}
-	else if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB_BY8 )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMicroSeconds  / AHB_BY8_TICK_TIME ) ;
-	}
-
-	/* Setting Reload Value */
-	( SYSTICK->SYST_RVR ) = RELOAD_Value ;
-
-	/* Clear Current */
-	( SYSTICK->SYST_CVR ) = 0 ;
-
-	/* Set Exception */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
+	/* Variable To Carry SysTick Clock */
+	uint32_t Local_u32Clock = 0 ;
 
-	/* Set Clock Source */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
+	/* Variable To Carry Number of Ticks */
+	uint64_t Local_u64Ticks = 0 ;
 
-	/* Enable Timer */
-	( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
+	Local_u8ErrorStatus = SYSTICK_GetClock( SYSTICK_TIMER_CONFIG.CLK , &Local_u32Clock ) ;
 
-	/* Check on Flag */
-	while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
+	if( Local_u8ErrorStatus == OK )
+	{
+		Local_u64Ticks = ( (uint64_t)Local_u32Clock * Copy_u32TimeInMicroSeconds ) / US_PER_SECOND ;
 
-	/* Disable Timer */
-	( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
+		if( Local_u64Ticks >= MIN_PERIOD_TICKS )
+		{
+			SYSTICK_Wait( Local_u64Ticks ) ;
+		}
+		else
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+	}
 
 	return Local_u8ErrorStatus ;
 }
@@ -162,34 +132,82 @@ ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds)
  * @parameter[in]	:	the Desired interrupt Time in MS
  * @parameter[in]	:	The Call back function
  * @retval			:	Error State
+ * @note			:	Intervals Beyond The 24-bit Reload Switch AHB to AHB / 8 When Exact , Otherwise The Interval
+ * 						is Split Into Equal Periods & The Call back Runs Once Every Chain of Periods
  */
 
-void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , void (* SYSTK_pfCallBackFunc )(void))
+ERRORS_t	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , void (* SYSTK_pfCallBackFunc )(void))
 {
-	if (NULL != SYSTK_pfCallBackFunc)
+	ERRORS_t Local_u8ErrorStatus = OK ;
+
+	uint32_t	CLOCK_VALUE		=0;
+	uint64_t	TICKS			=0;
+	uint32_t	CHAIN_PERIODS	=1;
+
+	if (NULL == SYSTK_pfCallBackFunc)
+	{
+		Local_u8ErrorStatus = Null_Pointer ;
+	}
+	else if (OK != SYSTICK_GetClock((uint8_t)Systick_CLK_SRC, &CLOCK_VALUE))
 	{
-		uint32_t	RELOAD_VALUE	=0;
-		if ( Systick_CLK_SRC == SYSTICK_CLOCK_AHB_DIVIDEDBY8)
+		Local_u8ErrorStatus = NOK ;
+	}
+	else
+	{
+		/*Calculate Interval in Ticks*/
+		TICKS	=	((uint64_t)CLOCK_VALUE * Time_ms) / MS_PER_SECOND;
+
+		/*Too Long For AHB : Count on AHB / 8 if The Interval Stays Exact There*/
+		if ((TICKS > MAX_PERIOD_TICKS) && (Systick_CLK_SRC == SYSTICK_CLOCK_AHB_DIRECT) && ((TICKS % AHB_PRESCALER) == 0)
+				&& (OK == SYSTICK_GetClock((uint8_t)SYSTICK_CLOCK_AHB_DIVIDEDBY8, &CLOCK_VALUE)))
 		{
-			/*Calculate Reload Value*/
-			RELOAD_VALUE	=	(Time_ms*1000)/AHB_BY8_TICK_TIME;
+			Systick_CLK_SRC	=	SYSTICK_CLOCK_AHB_DIVIDEDBY8;
+			TICKS			/=	AHB_PRESCALER;
 		}
-		else if ( Systick_CLK_SRC == SYSTICK_CLOCK_AHB_DIRECT)
+
+		/*Still Too Long : Smallest Number of Equal Periods That Fit The Reload , Ticks Per ms Always Divide Evenly*/
+		if (TICKS > MAX_PERIOD_TICKS)
 		{
-			/*Calculate Reload Value*/
-			RELOAD_VALUE	=	(Time_ms*1000)/AHB_TICK_TIME;
+			CHAIN_PERIODS	=	(uint32_t)((TICKS + MAX_PERIOD_TICKS - 1UL) / MAX_PERIOD_TICKS);
+
+			while ((CHAIN_PERIODS < Time_ms) && ((TICKS % CHAIN_PERIODS) != 0))
+			{
+				CHAIN_PERIODS++;
+			}
+
+			if ((TICKS % CHAIN_PERIODS) == 0)
+			{
+				TICKS	/=	CHAIN_PERIODS;
+			}
+			else
+			{
+				Local_u8ErrorStatus = NOK ;
+			}
 		}
 
-		/*Set reload value in the Reload Value Register*/
-		SYSTICK->SYST_RVR	=	RELOAD_VALUE;
+		if (TICKS < MIN_PERIOD_TICKS)
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+	}
+
+	if (Local_u8ErrorStatus == OK)
+	{
+		/*Stop SYSTICK While Reprogramming*/
+		SYSTICK ->SYST_CSR	&=	~(1<<(ENABLE_BIT_ACCESS));
+
+		/*Set reload value in the Reload Value Register , One Period is Reload + 1 Ticks*/
+		SYSTICK->SYST_RVR	=	(uint32_t)(TICKS - 1UL);
 
 		/*Clear the Current Value*/
 		SYSTICK->SYST_CVR	=0;
 
-		/*Set CallBack Globally*/
+		/*Set CallBack & Chain Globally*/
 		SYSTK_GpfCallBackFunc = SYSTK_pfCallBackFunc;
+		SYSTK_Gu32ChainPeriods = CHAIN_PERIODS;
+		SYSTK_Gu32ChainCount = 0;
 
-		/*Set the Clock Source to Processor Clock*/
+		/*Set the Clock Source*/
 		SYSTICK ->SYST_CSR	&=	~(1<<(CLKSRC_BIT_ACCESS));
 		SYSTICK ->SYST_CSR	|=	 (Systick_CLK_SRC<<(CLKSRC_BIT_ACCESS));
 
@@ -199,16 +217,121 @@ void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , vo
 		/*Enable SYSTICK*/
 		SYSTICK ->SYST_CSR	|=	(1<<(ENABLE_BIT_ACCESS));
 	}
-	else {
-		/*Error Do Nothing*/
+
+	return Local_u8ErrorStatus ;
+}
+
+/**
+ * @fn     : SYSTICK_GetClock
+ * @brief  : Function That Gets SysTick Counting Frequency From Configured HCLK & Clock Source
+ *           After Checking it Against SYST_CALIB
+ * @param  : Copy_u8ClockSource => CLKSOURCE Bit Value ( 0 : AHB / 8 , 1 : AHB )
+ * @param  : Copy_pu32Clock => Pointer to Returned Frequency in Hz
+ * @retval : ErrorStatus To Indicate if Function Worked Correctly or Not
+ **/
+static ERRORS_t SYSTICK_GetClock(uint8_t Copy_u8ClockSource, uint32_t *Copy_pu32Clock)
+{
+	ERRORS_t Local_u8ErrorStatus = OK ;
+
+	uint32_t Local_u32Calib = SYSTICK->SYST_CALIB ;
+	uint32_t Local_u32TenMs = ( Local_u32Calib & CALIB_TENMS_MASK ) ;
+
+	if( SYSTICK_TIMER_CONFIG.HCLK == 0 )
+	{
+		Local_u8ErrorStatus = NOK ;
+	}
+	else if( Copy_u8ClockSource == (uint8_t)SYSTICK_AHB )
+	{
+		*Copy_pu32Clock = SYSTICK_TIMER_CONFIG.HCLK ;
+	}
+	else if( Copy_u8ClockSource == (uint8_t)SYSTICK_AHB_BY8 )
+	{
+		/* NOREF : Chip Has no External Reference , AHB / 8 Would Never Count */
+		if( ( ( Local_u32Calib >> CALIB_NOREF ) & 0x01 ) == 0 )
+		{
+			*Copy_pu32Clock = SYSTICK_TIMER_CONFIG.HCLK / AHB_PRESCALER ;
+		}
+		else
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+	}
+	else
+	{
+		Local_u8ErrorStatus = NOK ;
+	}
+
+	/* TENMS Holds The Reference ( AHB / 8 ) Count For 1 ms at Maximum HCLK on STM32F4 ( 10 ms on Generic Cortex-M ) ,
+	 * a Configured HCLK Giving More Reference Ticks Per ms Than That is Beyond What The Chip Runs at */
+	if( ( Local_u8ErrorStatus == OK ) && ( Local_u32TenMs != 0 )
+			&& ( ( ( SYSTICK_TIMER_CONFIG.HCLK / AHB_PRESCALER ) / MS_PER_SECOND ) > ( Local_u32TenMs + 1UL ) ) )
+	{
+		Local_u8ErrorStatus = NOK ;
+	}
+
+	return Local_u8ErrorStatus ;
+}
+
+/**
+ * @fn     : SYSTICK_Wait
+ * @brief  : Fuction That Polls SysTick For a Number of Ticks , Chaining Reload Periods When Ticks Exceed 24-bit
+ * @param  : Copy_u64Ticks => Ticks To Wait ( At Least MIN_PERIOD_TICKS )
+ * @retval : void
+ **/
+static void SYSTICK_Wait(uint64_t Copy_u64Ticks)
+{
+	/* Variable To Carry Ticks of Current Period */
+	uint32_t Local_u32Period = 0 ;
+
+	/* Set Exception */
+	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
+	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
+
+	/* Set Clock Source */
+	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
+	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
+
+	while( Copy_u64Ticks > 0 )
+	{
+		Local_u32Period = ( Copy_u64Ticks > MAX_PERIOD_TICKS ) ? MAX_PERIOD_TICKS : (uint32_t)Copy_u64Ticks ;
+
+		/* Never Leave a Last Period Too Short to Count */
+		if( ( Copy_u64Ticks - Local_u32Period ) == 1 )
+		{
+			Local_u32Period-- ;
+		}
+
+		/* Setting Reload Value */
+		( SYSTICK->SYST_RVR ) = Local_u32Period - 1UL ;
+
+		/* Clear Current ( Also Clears COUNTFLAG ) */
+		( SYSTICK->SYST_CVR ) = 0 ;
+
+		/* Enable Timer */
+		( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
+
+		/* Check on Flag */
+		while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
+
+		/* Disable Timer */
+		( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
+
+		Copy_u64Ticks -= Local_u32Period ;
 	}
 }
 
 /*SYSTICK IRQ HANDLER*/
 void SysTick_Handler (void)
 {
-	if (NULL != SYSTK_GpfCallBackFunc)
+	SYSTK_Gu32ChainCount++;
+
+	if (SYSTK_Gu32ChainCount >= SYSTK_Gu32ChainPeriods)
 	{
-		SYSTK_GpfCallBackFunc();
+		SYSTK_Gu32ChainCount = 0;
+
+		if (NULL != SYSTK_GpfCallBackFunc)
+		{
+			SYSTK_GpfCallBackFunc();
+		}
 	}
 }
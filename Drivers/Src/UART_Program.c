@@ -39,6 +39,9 @@ static uint8_t UART_RecieveBufferSize[UARTNUMBER] = {0};
 static uint16_t *UART_RecievedBufferIT[UARTNUMBER] = {0};
 
 static uint16_t *UART_RecievedBuffer[UARTNUMBER] = {0};
+
+/* Call Back of Every Received Data While Receive Stream is Running */
+static void (*UART_RecieveStreamFunc[UARTNUMBER])(uint16_t Data) = {NULL};
 /*==============================================================================================================================================
  * FUNCTION DEFINITION SECTION
  *==============================================================================================================================================*/
@@ -195,6 +198,29 @@ void UART_u16ReceiveIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(void)
 	/* Enabling Read Data Register Not Empty Interrupt */
 	UART[UART_Config->UART_ID]->CR1 |= (1 << USART_RXNEIE);
 }
+/*==============================================================================================================================================
+ *@fn      : UART_voidReceiveStreamIT
+ *@brief  :  This is a function used to receive every data through UART peripheral using interrupts , Receive Interrupt Stays Enabled
+ *@paramter[in]  : UART_Config_t *UART_Config : Pointer to the UART peripheral configuration structure
+ *@paramter[in]  : pv_CallBackFunc : Called From ISR With Every Received Data , NULL Stops The Stream
+ *@retval void
+ *==============================================================================================================================================*/
+void UART_voidReceiveStreamIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(uint16_t Data))
+{
+	/* Setting CallBack Function */
+	UART_RecieveStreamFunc[UART_Config->UART_ID] = pv_CallBackFunc;
+
+	if (NULL != pv_CallBackFunc)
+	{
+		/* Enabling Read Data Register Not Empty Interrupt */
+		UART[UART_Config->UART_ID]->CR1 |= (1 << USART_RXNEIE);
+	}
+	else
+	{
+		/* Disabling Read Data Register Not Empty Interrupt */
+		UART[UART_Config->UART_ID]->CR1 &= ~(1 << USART_RXNEIE);
+	}
+}
 /*==============================================================================================================================================
  *@fn    USART_voidRecieveBuffer
  *@brief  This function is used to receive a string through UART peripheral using polling
@@ -305,7 +331,18 @@ void UART_voidTransmitBufferIT(UART_Config_t *UART_Config, uint16_t *Copy_p8Buff
  *==============================================================================================================================================*/
 static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 {
-	/* Comming from UART_ReciveBufferIT*/
+	/* Comming from UART_voidReceiveStreamIT , Only Receive Interrupt is Enabled */
+	if (NULL != UART_RecieveStreamFunc[UARTNumber])
+	{
+		/* Reading DR After SR Also Clears an OverRun */
+		if ((UART_ReadFlag(UARTNumber, RXNE_Flage) == 1) || (UART_ReadFlag(UARTNumber, ORE_Flage) == 1))
+		{
+			UART_RecieveStreamFunc[UARTNumber]((uint16_t)UART[UARTNumber]->DR);
+		}
+	}
+	else
+	{
+		/* Comming from UART_ReciveBufferIT*/
 		if ((UART_ReadFlag(UARTNumber, RXNE_Flage) == 1) && UART_RecieveBufferFlag[UARTNumber] == 1)
 		{
 			static uint8_t FlagCounter = 0;
@@ -392,6 +429,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 			/* Calling the CallBack Function */
 			UART_PTR_TO_FUNC[UARTNumber][PE_Flage]();
 		}
+	}
 }
 
 /*
@@ -46,6 +46,9 @@ typedef struct
 #define DS1307_WRITE_ARR_SIZE 0x08
 #define DS1307_RECEIVE_ARR_SIZE 0x07
 
+#define DS1307_RAM_FIRST_LOC 0x08 /* Address of First Location in DS1307 Battery Backed RAM */
+#define DS1307_RAM_SIZE 56u       /* Number of Battery Backed RAM Bytes ( 0x08 ~ 0x3F ) */
+
 #define DS1307_SLAVE_ADDRESS_WRITE 0b11010000
 #define DS1307_SLAVE_ADDRESS_READ  0b11010001
 
@@ -91,4 +94,26 @@ void DS1307_WriteDateTime(I2C_Configs_t * I2CConfig , DS1307_Config_t * Config
 
 DS1307_Config_t * DS1307_ReadDateTime( I2C_Configs_t * I2CConfig );
 
+/**
+ * @fn     : DS1307_WriteRAM
+ * @brief  : This Function Writes Bytes Into DS1307 Battery Backed RAM ( Kept Across Resets & Power Loss )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => First RAM Byte to Write ( 0 ~ DS1307_RAM_SIZE-1 )
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State
+ */
+Error_State_t DS1307_WriteRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size );
+
+/**
+ * @fn     : DS1307_ReadRAM
+ * @brief  : This Function Reads Bytes From DS1307 Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => First RAM Byte to Read ( 0 ~ DS1307_RAM_SIZE-1 )
+ * @param  : Data => Buffer to Fill
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State
+ */
+Error_State_t DS1307_ReadRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size );
+
 #endif /* DS1307_INCLUDE_DS1307_INTERFACE_H_ */
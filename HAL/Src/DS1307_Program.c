@@ -263,3 +263,88 @@ DS1307_Config_t * DS1307_ReadDateTime( I2C_Configs_t * I2CConfig )
 	return  DS1307_BCDToDateTime(ReceiveArr) ;
 
 }
+
+/**
+ * @fn     : DS1307_WriteRAM
+ * @brief  : This Function Writes Bytes Into DS1307 Battery Backed RAM ( Kept Across Resets & Power Loss )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => First RAM Byte to Write ( 0 ~ DS1307_RAM_SIZE-1 )
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State
+ */
+Error_State_t DS1307_WriteRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Local_u8Counter = 0 ;
+
+	/* Word Address Followed by Data Bytes */
+	uint8_t WriteArr[ DS1307_RAM_SIZE + 1 ] = { 0 } ;
+
+	if( ( NULL == I2CConfig ) || ( NULL == Data ) )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( ( 0 == Size ) || ( ( Offset + Size ) > DS1307_RAM_SIZE ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		WriteArr[ 0 ] = DS1307_RAM_FIRST_LOC + Offset ;
+
+		for( Local_u8Counter = 0 ; Local_u8Counter < Size ; Local_u8Counter++ )
+		{
+			WriteArr[ Local_u8Counter + 1 ] = Data[ Local_u8Counter ] ;
+		}
+
+		/* Word Address is Sent Before The Counted Data Bytes */
+		Error_State = I2C_Master_Transmit( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , WriteArr , Size ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS1307_ReadRAM
+ * @brief  : This Function Reads Bytes From DS1307 Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => First RAM Byte to Read ( 0 ~ DS1307_RAM_SIZE-1 )
+ * @param  : Data => Buffer to Fill
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State
+ */
+Error_State_t DS1307_ReadRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Local_u8Counter = 0 ;
+
+	if( ( NULL == I2CConfig ) || ( NULL == Data ) )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( ( 0 == Size ) || ( ( Offset + Size ) > DS1307_RAM_SIZE ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		/* Send Address Packet with Write */
+		I2C_SendAddressPacketMTransmitter( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE ) ;
+
+		/* Send Word Address of First RAM Byte */
+		I2C_SendDataPacket( I2CConfig , DS1307_RAM_FIRST_LOC + Offset ) ;
+
+		/* Repeated Start & Send Address Packet with Read */
+		I2C_SendAddressPacketMReceiver( I2CConfig , DS1307_SLAVE_ADDRESS_READ ) ;
+
+		for( Local_u8Counter = 0 ; Local_u8Counter < Size ; Local_u8Counter++ )
+		{
+			I2C_Master_Receive( I2CConfig , &Data[ Local_u8Counter ] ) ;
+		}
+
+		I2C_Send_Stop_Condition( I2CConfig->I2C_Num ) ;
+	}
+	return Error_State ;
+}
@@ -61,6 +61,7 @@ typedef enum  {  NOK , OK ,Null_Pointer,InvalidPORTPIN,DMA_OK,DMA_NOK,DMA_WRONG_
 	,SPI_WRONG_BAUDRATE
 	,SPI_WRONG_MULTIMASTER_STATE
 	,SPI_WRONG_SPI_NUMBER
+	,SPI_BUSY
 	,WRONG_SLAVE_STATE
 	,I2C_WRONG_CLK_STRETCH_STATE
 	,I2C_WRONG_SCL_FREQUENCY
@@ -31,12 +31,58 @@
 /* ------------------------------------------------------------------------------------------------ */
 #define ALIAS_ADDRESS(BIT_BAND_ADDRESS, BIT_NO) (ALIAS_BASE_ADDRESS + (BIT_NO * 4UL) + (32UL * ((uint32_t)BIT_BAND_ADDRESS - BIT_BAND_BASE_ADDRESS)))
 
+/* --------------------------------------------------------------------------------------- */
+/* ------------------------------- CRITICAL SECTION MACROS ------------------------------- */
+/* --------------------------------------------------------------------------------------- */
+#ifdef HOST_SIMULATION
+/* Host Build : Nothing Preempts The Code Under Test , Nothing to Mask or Wait For */
+#define ENTER_CRITICAL(PRIMASK_STATE) ((PRIMASK_STATE) = 0u)
+#define EXIT_CRITICAL(PRIMASK_STATE) ((void)(PRIMASK_STATE))
+#define WAIT_FOR_INTERRUPT() \
+	do                       \
+	{                        \
+	} while (0)
+#else
+/* Save PRIMASK in a uint32_t Variable Then Mask All Configurable Interrupts */
+#define ENTER_CRITICAL(PRIMASK_STATE)                                     \
+	do                                                                    \
+	{                                                                     \
+		__asm volatile("MRS %0, PRIMASK" : "=r"(PRIMASK_STATE)::"memory"); \
+		__asm volatile("CPSID I" ::: "memory");                           \
+	} while (0)
+
+/* Restore PRIMASK Saved by ENTER_CRITICAL ( Safe When Nested or Called From ISR ) */
+#define EXIT_CRITICAL(PRIMASK_STATE) __asm volatile("MSR PRIMASK, %0" ::"r"(PRIMASK_STATE) : "memory")
+
+/* Sleep Till an Interrupt is Pending , Wakes Even Inside ENTER_CRITICAL ( Handler Runs Once PRIMASK is Restored ) */
+#define WAIT_FOR_INTERRUPT() __asm volatile("DSB\n\tWFI\n\tISB" ::: "memory")
+#endif
+
 /* ------------------------------------------------------------------------------------------------------- */
 /* ------------------------------- VARIOUS MEMORIES BASE ADDRESSES SECTION ------------------------------- */
 /* ------------------------------------------------------------------------------------------------------- */
 #define FLASH_BASE_ADDRESS 0x08000000UL
 #define SRAM_BASE_ADDRESS 0x20000000UL
 #define ROM_BASE_ADDRESS 0x1FFF0000UL
+#define PERIPH_BASE_ADDRESS 0x40000000UL
+#define CORE_PERIPH_BASE_ADDRESS 0xE0000000UL
+
+/* ------------------------------------------------------------------------------------------- */
+/* ------------------------------- REGISTER BLOCK ADDRESS MACRO ------------------------------- */
+/* ------------------------------------------------------------------------------------------- */
+#ifdef HOST_SIMULATION
+/* Host Build : Register Blocks Live in RAM Images of Peripheral & Core Peripheral Regions
+ * ( Simulation/Src/Host_Registers.c ) , Drivers Run Unchanged Against Them */
+#define HOST_PERIPH_REGION_WORDS (0x80000UL / 4UL)
+#define HOST_CORE_REGION_WORDS (0x10000UL / 4UL)
+
+extern uint32_t HostRegisters_Periph[HOST_PERIPH_REGION_WORDS];
+extern uint32_t HostRegisters_Core[HOST_CORE_REGION_WORDS];
+
+#define REGISTER_BLOCK(BASE_ADDRESS) (((BASE_ADDRESS) >= CORE_PERIPH_BASE_ADDRESS) ? &HostRegisters_Core[((BASE_ADDRESS) - CORE_PERIPH_BASE_ADDRESS) / 4UL] : &HostRegisters_Periph[((BASE_ADDRESS) - PERIPH_BASE_ADDRESS) / 4UL])
+#else
+#define REGISTER_BLOCK(BASE_ADDRESS) (BASE_ADDRESS)
+#endif
 
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- AHB1 PERIPHERAL BASE ADDRESSES ------------------------------- */
@@ -96,6 +142,8 @@
 #define SYSTICK_BASE_ADDRESS 0xE000E010UL
 #define NVIC_BASE_ADDRESS 0xE000E100UL
 #define SCB_BASE_ADDRESS 0xE000E008UL
+#define DWT_BASE_ADDRESS 0xE0001000UL
+#define COREDEBUG_BASE_ADDRESS 0xE000EDF0UL
 
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- RCC REGISTERS Definition Structure ------------------------------- */
@@ -144,7 +192,7 @@ typedef struct
 /* ------------------------------- RCC Peripheral Definition ------------------------------- */
 /* ----------------------------------------------------------------------------------------- */
 
-#define RCC ((RCC_RegDef_t *)RCC_BASE_ADDRESS)
+#define RCC ((RCC_RegDef_t *)REGISTER_BLOCK(RCC_BASE_ADDRESS))
 
 /* ---------------------------------------------------------------------------------- */
 /* ------------------------------- RCC REGISTERS Bits ------------------------------- */
@@ -206,14 +254,14 @@ typedef struct
 /* ------------------------------------------------------------------------------------------- */
 /* ------------------------------- GPIO Peripheral Definitions ------------------------------- */
 /* ------------------------------------------------------------------------------------------- */
-#define GPIOA ((GPIO_RegDef_t *)GPIOA_BASE_ADDRESS)
-#define GPIOB ((GPIO_RegDef_t *)GPIOB_BASE_ADDRESS)
-#define GPIOC ((GPIO_RegDef_t *)GPIOC_BASE_ADDRESS)
-#define GPIOD ((GPIO_RegDef_t *)GPIOD_BASE_ADDRESS)
-#define GPIOE ((GPIO_RegDef_t *)GPIOE_BASE_ADDRESS)
-#define GPIOF ((GPIO_RegDef_t *)GPIOF_BASE_ADDRESS)
-#define GPIOG ((GPIO_RegDef_t *)GPIOG_BASE_ADDRESS)
-#define GPIOH ((GPIO_RegDef_t *)GPIOH_BASE_ADDRESS)
+#define GPIOA ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOA_BASE_ADDRESS))
+#define GPIOB ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOB_BASE_ADDRESS))
+#define GPIOC ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOC_BASE_ADDRESS))
+#define GPIOD ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOD_BASE_ADDRESS))
+#define GPIOE ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOE_BASE_ADDRESS))
+#define GPIOF ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOF_BASE_ADDRESS))
+#define GPIOG ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOG_BASE_ADDRESS))
+#define GPIOH ((GPIO_RegDef_t *)REGISTER_BLOCK(GPIOH_BASE_ADDRESS))
 
 /* ------------------------------------------------------------------------------------------------------ */
 /* ------------------------------- SYSTICK REGISTERS Definition Structure ------------------------------- */
@@ -229,7 +277,7 @@ typedef struct
 /* --------------------------------------------------------------------------------------------- */
 /* ------------------------------- SYSTICK Peripheral Definition ------------------------------- */
 /* --------------------------------------------------------------------------------------------- */
-#define SYSTICK ((SYSTICK_RegDef_t *)SYSTICK_BASE_ADDRESS)
+#define SYSTICK ((SYSTICK_RegDef_t *)REGISTER_BLOCK(SYSTICK_BASE_ADDRESS))
 
 /* -------------------------------------------------------------------------------------- */
 /* ------------------------------- SYSTICK REGISTERS Bits ------------------------------- */
@@ -241,6 +289,11 @@ typedef struct
 #define CSR_TICKINT 1
 #define CSR_ENABLE 0
 
+/* SYST_CALIB */
+#define CALIB_NOREF 31
+#define CALIB_SKEW 30
+#define CALIB_TENMS_MASK 0x00FFFFFFUL
+
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- NVIC REGISTERS Definition Structure ------------------------------ */
 /* -------------------------------------------------------------------------------------------------- */
@@ -264,7 +317,7 @@ typedef struct
 /* ------------------------------------------------------------------------------------------ */
 /* ------------------------------- NVIC Peripheral Definition ------------------------------- */
 /* ------------------------------------------------------------------------------------------ */
-#define NVIC ((NVIC_RegDef_t *)NVIC_BASE_ADDRESS)
+#define NVIC ((NVIC_RegDef_t *)REGISTER_BLOCK(NVIC_BASE_ADDRESS))
 
 /* ------------------------------------------------------------------------------------------------- */
 /* ------------------------------- SCB REGISTERS Definition Structure ------------------------------ */
@@ -294,7 +347,52 @@ typedef struct
 /* ----------------------------------------------------------------------------------------- */
 /* ------------------------------- SCB Peripheral Definition ------------------------------- */
 /* ----------------------------------------------------------------------------------------- */
-#define SCB ((SCB_RegDef_t *)SCB_BASE_ADDRESS)
+#define SCB ((SCB_RegDef_t *)REGISTER_BLOCK(SCB_BASE_ADDRESS))
+
+/* SCB_ICSR */
+#define ICSR_PENDSTSET 26
+
+/* ------------------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT REGISTERS Definition Structure ------------------------------ */
+/* ------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	volatile uint32_t CTRL;		 /* Control Register */
+	volatile uint32_t CYCCNT;	 /* Cycle Count Register */
+	volatile uint32_t CPICNT;	 /* CPI Count Register */
+	volatile uint32_t EXCCNT;	 /* Exception Overhead Count Register */
+	volatile uint32_t SLEEPCNT; /* Sleep Count Register */
+	volatile uint32_t LSUCNT;	 /* LSU Count Register */
+	volatile uint32_t FOLDCNT;	 /* Folded-instruction Count Register */
+	volatile uint32_t PCSR;		 /* Program Counter Sample Register */
+} DWT_RegDef_t;
+
+/* ----------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT Peripheral Definition ------------------------------- */
+/* ----------------------------------------------------------------------------------------- */
+#define DWT ((DWT_RegDef_t *)REGISTER_BLOCK(DWT_BASE_ADDRESS))
+
+/* DWT_CTRL */
+#define DWT_CTRL_CYCCNTENA 0
+
+/* -------------------------------------------------------------------------------------------------------- */
+/* ------------------------------- CORE DEBUG REGISTERS Definition Structure ------------------------------ */
+/* -------------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	volatile uint32_t DHCSR; /* Debug Halting Control and Status Register */
+	volatile uint32_t DCRSR; /* Debug Core Register Selector Register */
+	volatile uint32_t DCRDR; /* Debug Core Register Data Register */
+	volatile uint32_t DEMCR; /* Debug Exception and Monitor Control Register */
+} COREDEBUG_RegDef_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- CORE DEBUG Peripheral Definition ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+#define COREDEBUG ((COREDEBUG_RegDef_t *)REGISTER_BLOCK(COREDEBUG_BASE_ADDRESS))
+
+/* DEMCR */
+#define DEMCR_TRCENA 24
 
 /* ---------------------------------------------------------------------------------------------------- */
 /* ------------------------------- SYSCFG REGISTERS Definition Structure ------------------------------ */
@@ -315,7 +413,7 @@ typedef struct
 /* -------------------------------------------------------------------------------------------- */
 /* ------------------------------- SYSCFG Peripheral Definition ------------------------------- */
 /* -------------------------------------------------------------------------------------------- */
-#define SYSCFG ((SYSCFG_RegDef_t *)SYSCFG_BASE_ADDRESS)
+#define SYSCFG ((SYSCFG_RegDef_t *)REGISTER_BLOCK(SYSCFG_BASE_ADDRESS))
 
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- EXTI REGISTERS Definition Structure ------------------------------ */
@@ -333,7 +431,7 @@ typedef struct
 /* ------------------------------------------------------------------------------------------ */
 /* ------------------------------- EXTI Peripheral Definition ------------------------------- */
 /* ------------------------------------------------------------------------------------------ */
-#define EXTI ((EXTI_RegDef_t *)EXTI_BASE_ADDRESS)
+#define EXTI ((EXTI_RegDef_t *)REGISTER_BLOCK(EXTI_BASE_ADDRESS))
 
 /* ------------------------------------------------------------------------------------------------- */
 /* ------------------------------- DMA REGISTERS Definition Structure ------------------------------ */
@@ -352,8 +450,10 @@ typedef struct
 
 typedef struct
 {
-	volatile uint16_t ISR[4];				/* DMA Interrupt Status Registers */
-	volatile uint16_t IFCR[4];				/* DMA Interrupt Flag Clear Registers */
+	volatile uint32_t LISR;					/* DMA Low Interrupt Status Register ( Streams 0 ~ 3 ) */
+	volatile uint32_t HISR;					/* DMA High Interrupt Status Register ( Streams 4 ~ 7 ) */
+	volatile uint32_t LIFCR;				/* DMA Low Interrupt Flag Clear Register ( Streams 0 ~ 3 ) */
+	volatile uint32_t HIFCR;				/* DMA High Interrupt Flag Clear Register ( Streams 4 ~ 7 ) */
 	volatile DMA_Stream_RegDef_t STREAM[8]; /* DMA Stream Registers */
 
 } DMA_RegDef_t;
@@ -361,8 +461,8 @@ typedef struct
 /* ----------------------------------------------------------------------------------------- */
 /* ------------------------------- DMA Peripheral Definition ------------------------------- */
 /* ----------------------------------------------------------------------------------------- */
-#define DMA1 ((DMA_RegDef_t *)DMA1_BASE_ADDRESS)
-#define DMA2 ((DMA_RegDef_t *)DMA2_BASE_ADDRESS)
+#define DMA1 ((DMA_RegDef_t *)REGISTER_BLOCK(DMA1_BASE_ADDRESS))
+#define DMA2 ((DMA_RegDef_t *)REGISTER_BLOCK(DMA2_BASE_ADDRESS))
 
 /* ---------------------------------------------------------------------------------- */
 /* ------------------------------- DMA REGISTERS Bits ------------------------------- */
@@ -428,12 +528,12 @@ typedef struct
 /* ------------------------------------------------------------------------------------------- */
 /* ------------------------------- USART Peripheral Definition ------------------------------- */
 /* ------------------------------------------------------------------------------------------- */
-#define USART1 ((USART_Reg_t *)USART1_BASE_ADDRESS)
-#define USART2 ((USART_Reg_t *)USART2_BASE_ADDRESS)
-#define USART3 ((USART_Reg_t *)USART3_BASE_ADDRESS)
-#define UART4 ((USART_Reg_t *)UART4_BASE_ADDRESS)
-#define UART5 ((USART_Reg_t *)UART5_BASE_ADDRESS)
-#define USART6 ((USART_Reg_t *)USART6_BASE_ADDRESS)
+#define USART1 ((USART_Reg_t *)REGISTER_BLOCK(USART1_BASE_ADDRESS))
+#define USART2 ((USART_Reg_t *)REGISTER_BLOCK(USART2_BASE_ADDRESS))
+#define USART3 ((USART_Reg_t *)REGISTER_BLOCK(USART3_BASE_ADDRESS))
+#define UART4 ((USART_Reg_t *)REGISTER_BLOCK(UART4_BASE_ADDRESS))
+#define UART5 ((USART_Reg_t *)REGISTER_BLOCK(UART5_BASE_ADDRESS))
+#define USART6 ((USART_Reg_t *)REGISTER_BLOCK(USART6_BASE_ADDRESS))
 
 /* ------------------------------------------------------------------------------------ */
 /* ------------------------------- USART REGISTERS Bits ------------------------------- */
@@ -538,10 +638,10 @@ typedef struct
 #define SPI_REG_t	SPI_RegDef_t
 
 
-#define SPI1 ((SPI_RegDef_t *)SPI1_BASE_ADDRESS)
-#define SPI2 ((SPI_RegDef_t *)SPI2_BASE_ADDRESS)
-#define SPI3 ((SPI_RegDef_t *)SPI3_BASE_ADDRESS)
-#define SPI4 ((SPI_RegDef_t *)SPI4_BASE_ADDRESS)
+#define SPI1 ((SPI_RegDef_t *)REGISTER_BLOCK(SPI1_BASE_ADDRESS))
+#define SPI2 ((SPI_RegDef_t *)REGISTER_BLOCK(SPI2_BASE_ADDRESS))
+#define SPI3 ((SPI_RegDef_t *)REGISTER_BLOCK(SPI3_BASE_ADDRESS))
+#define SPI4 ((SPI_RegDef_t *)REGISTER_BLOCK(SPI4_BASE_ADDRESS))
 
 
 /* ----------------------------------------------------------------------------------- */
@@ -604,9 +704,9 @@ typedef struct {
 /* ----------------------------------------------------------------------------------------- */
 /* ------------------------------- I2C Peripheral Definition ------------------------------- */
 /* ----------------------------------------------------------------------------------------- */
-#define I2C1 ((I2C_REG_t *)I2C1_BASE_ADDRESS)
-#define I2C2 ((I2C_REG_t *)I2C2_BASE_ADDRESS)
-#define I2C3 ((I2C_REG_t *)I2C3_BASE_ADDRESS)
+#define I2C1 ((I2C_REG_t *)REGISTER_BLOCK(I2C1_BASE_ADDRESS))
+#define I2C2 ((I2C_REG_t *)REGISTER_BLOCK(I2C2_BASE_ADDRESS))
+#define I2C3 ((I2C_REG_t *)REGISTER_BLOCK(I2C3_BASE_ADDRESS))
 
 /* ----------------------------------------------------------------------------------- */
 /* ------------------------------- I2C REGISTERS' Bits ------------------------------- */
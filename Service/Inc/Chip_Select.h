@@ -0,0 +1,72 @@
+/*
+ ******************************************************************************
+ * @file           : Chip_Select.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software SPI Chip Select Manager Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_CHIP_SELECT_H_
+#define INC_CHIP_SELECT_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Max GPIO NSS Lines Managed on One Bus */
+#define CHIP_SELECT_MAX_LINES		4u
+
+/* No Line Asserted */
+#define CHIP_SELECT_NONE			0xFFu
+
+/* ========================================================================= *
+ *                              TYPES SECTION                                *
+ * ========================================================================= */
+
+/* One Active Low NSS Line */
+typedef struct
+{
+	Port_t Port;
+	Pin_t PinNum;
+
+} ChipSelect_Line_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Init
+ * @brief			:	Configure NSS Lines as Outputs & Release Them All ( High )
+ * @param			:	Lines => Line Table , Index in Table is The Line Number ( Kept by Reference )
+ * @param			:	LinesNumber => Number of Lines ( Max CHIP_SELECT_MAX_LINES )
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ChipSelect_Init(const ChipSelect_Line_t *Lines, uint8_t LinesNumber);
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Assert
+ * @brief			:	Drive One NSS Line Low , Releasing The Line Asserted Before if Any
+ * @param			:	Line => Line Number
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ChipSelect_Assert(uint8_t Line);
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Release
+ * @brief			:	Drive Asserted NSS Line High , Ends The Transaction For That Slave
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call Only After BSY is Cleared or The Last Frame is Cut
+ * ======================================================================================*/
+void ChipSelect_Release(void);
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_GetAsserted
+ * @brief			:	Line Currently Driven Low
+ * @param			:	void
+ * @retval			:	Line Number or CHIP_SELECT_NONE
+ * ======================================================================================*/
+uint8_t ChipSelect_GetAsserted(void);
+
+#endif /* INC_CHIP_SELECT_H_ */
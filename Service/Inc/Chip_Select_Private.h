@@ -0,0 +1,19 @@
+/*
+ ******************************************************************************
+ * @file           : Chip_Select_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software SPI Chip Select Manager Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _CHIP_SELECT_PRIVATE_H_
+#define _CHIP_SELECT_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* NSS Lines Switch Every Frame , Edges Must be Sharp at Fpclk/2 */
+#define CHIP_SELECT_PIN_SPEED		MEDIUM_SPEED
+
+#endif /* _CHIP_SELECT_PRIVATE_H_ */
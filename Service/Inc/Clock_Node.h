@@ -0,0 +1,84 @@
+/*
+ ******************************************************************************
+ * @file           : Clock_Node.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SPI2 Slave Clock Node Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_CLOCK_NODE_H_
+#define INC_CLOCK_NODE_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* A Clock Node Follows a Master Clock on SPI2 , One Frame Per NSS Transaction :
+ *
+ *   | OPCODE | LENGTH | PAYLOAD ( LENGTH Bytes ) | CRC8 |
+ *
+ * Same Layout & CRC8 as Panda Link Frames , CRC8 is Always Present on Node Frames .
+ * First Byte Clocked Back to Master is The Verdict ( PANDA_STATUS_ACK / NAK ) on The Previous Frame ,
+ * a Frame That Overran SPI2 is NAKed . Link Rate is Set by Master SPI1 Prescaler , Slave Only Follows It .
+ * As Master , a Clock Sends Its Node These Frames on SPI1 ( Panda Link Device PANDA_DEVICE_CLOCK_NODE )
+ */
+
+/* Time Payload : Seconds , Minutes , Hours , Day , Month , Year , Date ( Panda Display Payload Order ) */
+#define CLOCK_NODE_TIME_PAYLOAD_SIZE	7u
+
+/* Alarm Table Payload : Hours , Minutes , Seconds Per Alarm , 0xFF Hours Marks an Empty Alarm */
+#define CLOCK_NODE_ALARM_FIELDS			3u
+#define CLOCK_NODE_ALARMS_PAYLOAD_SIZE	(CLOCK_NODE_ALARM_FIELDS * ALARMS_NUMBER)
+
+/* ========================================================================= *
+ *                              ENUMS SECTION                                *
+ * ========================================================================= */
+
+/* Opcodes Sent by Master Clock to Its Nodes */
+typedef enum
+{
+	CLOCK_NODE_OPCODE_TIME = 0x54,		/* Set Node RTC */
+	CLOCK_NODE_OPCODE_ALARMS = 0x55		/* Replace Node Alarm Table */
+
+} CLOCK_NODE_OPCODE_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Init
+ * @brief			:	Configure SPI2 as Slave With Hardware NSS , DMA1 Stream3 to Drain its Rx Buffer
+ * 						& NSS Rising Edge Interrupt , Then Arm Reception of The First Frame
+ * @param			:	void
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ClockNode_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Tick
+ * @brief			:	Apply Time & Alarm Table Received From Master ( RTC is Written Here ,
+ * 						Not in The NSS Interrupt )
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Every Second From Service Tick Event Handler Before Alarms Are Compared
+ * ======================================================================================*/
+void ClockNode_Tick(void);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_SendTime
+ * @brief			:	Master Side , Queue a Time Frame For The Clock Node on SPI1
+ * @param			:	Time => Time Just Written in The RTC
+ * @retval			:	Error State ( NOK if Panda Link Queue is Full )
+ * ======================================================================================*/
+Error_State_t ClockNode_SendTime(const DS1307_Config_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_SendAlarms
+ * @brief			:	Master Side , Queue The Whole Alarm Table For The Clock Node on SPI1
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Panda Link Queue is Full )
+ * ======================================================================================*/
+Error_State_t ClockNode_SendAlarms(void);
+
+#endif /* INC_CLOCK_NODE_H_ */
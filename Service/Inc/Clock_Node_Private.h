@@ -0,0 +1,92 @@
+/*
+ ******************************************************************************
+ * @file           : Clock_Node_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SPI2 Slave Clock Node Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _CLOCK_NODE_PRIVATE_H_
+#define _CLOCK_NODE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* SPI2 Pins ( AF5 ) : NSS PB12 , SCK PB13 , MISO PB14 , MOSI PB15 */
+#define CLOCK_NODE_PINS_NUMBER		4u
+#define CLOCK_NODE_NSS_PIN			PIN12
+#define CLOCK_NODE_SCK_PIN			PIN13
+#define CLOCK_NODE_MISO_PIN			PIN14
+#define CLOCK_NODE_MOSI_PIN			PIN15
+
+/* NSS is Also Watched by EXTI12 to Find Where Every Frame Ends */
+#define CLOCK_NODE_NSS_EXTI			EXTI12
+#define CLOCK_NODE_NSS_SYSCFG_LINE	EXTI_LINE12
+
+/* Largest Node Frame : Header , Alarm Table & CRC8 */
+#define CLOCK_NODE_HEADER_SIZE		2u
+#define CLOCK_NODE_CRC_SIZE			1u
+#define CLOCK_NODE_MAX_FRAME_SIZE	(CLOCK_NODE_HEADER_SIZE + CLOCK_NODE_ALARMS_PAYLOAD_SIZE + CLOCK_NODE_CRC_SIZE)
+
+/* Rx Stream Length , a Frame Filling it is Longer Than Any Valid One */
+#define CLOCK_NODE_RX_BUFFER_SIZE	(CLOCK_NODE_MAX_FRAME_SIZE + 1u)
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS PROTOTYPES SECTION                   *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_FrameEnd
+ * @brief			:	NSS Rising Edge Call Back , Frame Length is What Rx Stream Moved ( From NDTR ) ,
+ * 						Decodes The Frame & Arms The Next One With The Verdict as Reply
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	A Frame That Overran SPI2 Lost a Byte Somewhere , it is Dropped Without Decoding
+ * ======================================================================================*/
+static void ClockNode_FrameEnd(void);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_StartFrame
+ * @brief			:	Load The Verdict as Reply & Start Rx Stream on The Whole Frame Buffer
+ * @param			:	void
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_StartFrame(void);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Decode
+ * @brief			:	Check a Received Frame & Stage its Payload For ClockNode_Tick
+ * @param			:	Frame => Received Bytes
+ * @param			:	Size => Number of Received Bytes
+ * @retval			:	Error State ( NOK if Frame is Malformed , Corrupted or Unknown )
+ * ======================================================================================*/
+static Error_State_t ClockNode_Decode(const uint8_t *Frame, uint8_t Size);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_CheckTime
+ * @brief			:	Range Check of a Time Payload
+ * @param			:	Time => Time Payload
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_CheckTime(const uint8_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Send
+ * @brief			:	Encode a Node Frame ( CRC8 Always Appended ) & Queue it For The Clock Node
+ * @param			:	Opcode => Node Frame Opcode
+ * @param			:	Payload => Payload Bytes
+ * @param			:	Length => Number of Payload Bytes
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_Send(CLOCK_NODE_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length);
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Sent
+ * @brief			:	Call Back of Node Frames , Verdict Comes in The Next Reply
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void ClockNode_Sent(void);
+
+#endif /* _CLOCK_NODE_PRIVATE_H_ */
@@ -0,0 +1,70 @@
+/*
+ ******************************************************************************
+ * @file           : Display_Stream.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Live Clock Streaming to Panda LCD Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_DISPLAY_STREAM_H_
+#define INC_DISPLAY_STREAM_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Stream Payload : Display Payload Followed by Phase Byte ( Service Ticks Since RTC Second Changed ) */
+#define DISPLAY_STREAM_PAYLOAD_SIZE		(PANDA_DISPLAY_PAYLOAD_SIZE + 1u)
+
+/* Delta Frame : Field Mask ( Bit n Set => Payload Field n Changed ) Followed by Changed Fields in Order ,
+ * Full Frame ( Keyframe ) is Sent at Start , After a Dropped Frame & Every DISPLAY_STREAM_KEYFRAME_PERIOD Frames */
+#define DISPLAY_STREAM_KEYFRAME_PERIOD	60u
+
+/* Rate Used When User Chooses Display Date & Time */
+#define DISPLAY_STREAM_DEFAULT_RATE		DISPLAY_RATE_1HZ
+
+/* ========================================================================= *
+ *                              ENUMS SECTION                                *
+ * ========================================================================= */
+
+/* Frames Per Second , Must Divide Service Ticks Per Second */
+typedef enum
+{
+	DISPLAY_RATE_1HZ = 1,
+	DISPLAY_RATE_2HZ = 2,
+	DISPLAY_RATE_5HZ = 5,
+	DISPLAY_RATE_10HZ = 10
+
+} DISPLAY_RATE_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Start
+ * @brief			:	Start Pushing Current Time to Panda , Frames Are Aligned to RTC Second
+ * @param			:	Rate => Frames Per Second
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t DisplayStream_Start(DISPLAY_RATE_t Rate);
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Stop
+ * @brief			:	Stop Pushing Time to Panda , Frame in Flight is Completed
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void DisplayStream_Stop(void);
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Tick
+ * @brief			:	Stream Heart Beat , Pushes a Frame When it is Due
+ * @param			:	Time => RTC Time Already Read This Tick , NULL to Read it Here Only if Stream is Running
+ * @retval			:	void
+ * @note			:	Called Every SERVICE_TICK_MS From Service Tick Event Handler ( Thread Mode ,
+ * 						RTC is Read Over I2C With Interrupts Enabled )
+ * ======================================================================================*/
+void DisplayStream_Tick(const DS1307_Config_t *Time);
+
+#endif /* INC_DISPLAY_STREAM_H_ */
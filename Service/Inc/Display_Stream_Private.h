@@ -0,0 +1,52 @@
+/*
+ ******************************************************************************
+ * @file           : Display_Stream_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Live Clock Streaming Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _DISPLAY_STREAM_PRIVATE_H_
+#define _DISPLAY_STREAM_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define DISPLAY_STREAM_TICKS_PER_SECOND		(1000u / SERVICE_TICK_MS)
+
+#define DISPLAY_STREAM_NO_SECOND			0xFFu
+
+#define DISPLAY_STREAM_PHASE_INDEX			PANDA_DISPLAY_PAYLOAD_SIZE
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Push
+ * @brief			:	Hand Back Buffer to Panda Link & Swap Buffers
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Must be Called With Interrupts Masked or From DisplayStream_Sent
+ * ======================================================================================*/
+static void DisplayStream_Push(void);
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Encode
+ * @brief			:	Build Keyframe or Delta Frame of Back Buffer Against Last Acknowledged Frame
+ * @param			:	Frame => Buffer of DISPLAY_STREAM_PAYLOAD_SIZE + 1 Bytes
+ * @param			:	Length => Number of Bytes Written in Frame
+ * @retval			:	Frame Opcode
+ * ======================================================================================*/
+static PANDA_OPCODE_t DisplayStream_Encode(uint8_t *Frame, uint8_t *Length);
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Sent
+ * @brief			:	Panda Link Call Back , Pushes The Frame Encoded Meanwhile ( If Any )
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void DisplayStream_Sent(void);
+
+#endif /* _DISPLAY_STREAM_PRIVATE_H_ */
@@ -0,0 +1,116 @@
+/*
+ ******************************************************************************
+ * @file           : Event_Loop.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Loop Header File
+ * @Date           : Sep 3, 2023
+ ******************************************************************************
+ */
+#ifndef INC_EVENT_LOOP_H_
+#define INC_EVENT_LOOP_H_
+
+/* ========================================================================= *
+ *                              ENUMS SECTION                                *
+ * ========================================================================= */
+
+/* Events Posted by Interrupts ( or Handlers ) & Dispatched in Main Loop */
+typedef enum
+{
+	EVENT_UART_RX = 0,		/* Data => Character Received on Terminal USART */
+	EVENT_SERVICE_TICK,		/* Every SERVICE_TICK_MS */
+	EVENT_ALARM_MATCH,		/* Arg => Alarm Index Due to be Sent to Panda */
+	EVENT_SPI_DONE,			/* Alarm Frame Clocked Out on SPI1 */
+	EVENT_PANDA_INPUT,		/* Arg => Event Byte Clocked Back by Panda */
+	EVENT_PANDA_STATUS,		/* Frame Out in PANDA_LINK_CRC_HW Mode , Status Byte Due */
+
+	EVENTS_NUMBER
+
+} EVENT_ID_t;
+
+/* ========================================================================= *
+ *                              TYPES SECTION                                *
+ * ========================================================================= */
+
+/* Compact Event , Copied in & out of The Queue */
+typedef struct
+{
+	uint8_t ID;
+	uint8_t Arg;
+	uint16_t Data;
+
+} EVENT_t;
+
+/* Runs in Thread Mode , Must Not Wait For Events Itself */
+typedef void (*EVENT_HANDLER_t)(const EVENT_t *Event);
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Init
+ * @brief			:	Empty The Event Queue & Drop Every Handler
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Before Any Interrupt That Posts Events is Enabled
+ * ======================================================================================*/
+void EventLoop_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Subscribe
+ * @brief			:	Set The Handler Dispatched For an Event , NULL Discards That Event
+ * @param			:	ID => Event
+ * @param			:	Handler => Function to Run For Every Such Event
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t EventLoop_Subscribe(EVENT_ID_t ID, EVENT_HANDLER_t Handler);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Post
+ * @brief			:	Queue an Event Without Masking Interrupts
+ * @param			:	ID => Event
+ * @param			:	Arg => Event Byte Argument
+ * @param			:	Data => Event Half Word Argument
+ * @retval			:	Error State ( NOK if Queue is Full , Event is Dropped & Counted )
+ * @note			:	Safe From Any Interrupt Priority & From Thread Mode
+ * ======================================================================================*/
+Error_State_t EventLoop_Post(EVENT_ID_t ID, uint8_t Arg, uint16_t Data);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Dispatch
+ * @brief			:	Run Handlers of Queued Events in Order , Each to Completion
+ * @param			:	void
+ * @retval			:	Number of Events Taken From The Queue
+ * @note			:	At Most EVENT_LOOP_QUEUE_SIZE Events Per Call , Thread Mode Only
+ * ======================================================================================*/
+uint8_t EventLoop_Dispatch(void);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_WaitFor
+ * @brief			:	Dispatch Every Other Event Until an Event of Given ID is Queued ,
+ * 						Core Sleeps While Queue is Empty
+ * @param			:	ID => Awaited Event
+ * @param			:	Event => Receives Awaited Event , its Handler is Not Run
+ * @retval			:	Error State
+ * @note			:	Thread Mode Only , Never From a Handler
+ * ======================================================================================*/
+Error_State_t EventLoop_WaitFor(EVENT_ID_t ID, EVENT_t *Event);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_IsPending
+ * @brief			:	Check if Any Event is Queued
+ * @param			:	void
+ * @retval			:	FLAG_SET if an Event Waits For Dispatch , Else FLAG_RESET
+ * @note			:	Thread Mode , Call With Interrupts Masked to Decide Whether to Sleep
+ * ======================================================================================*/
+uint8_t EventLoop_IsPending(void);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_GetDropped
+ * @brief			:	Number of Events Dropped Because Queue Was Full
+ * @param			:	void
+ * @retval			:	Dropped Events Since Init
+ * ======================================================================================*/
+uint32_t EventLoop_GetDropped(void);
+
+#endif /* INC_EVENT_LOOP_H_ */
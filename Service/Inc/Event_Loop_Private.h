@@ -0,0 +1,57 @@
+/*
+ ******************************************************************************
+ * @file           : Event_Loop_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Loop Private Header file
+ * @Date           : Sep 3, 2023
+ ******************************************************************************
+ */
+#ifndef _EVENT_LOOP_PRIVATE_H_
+#define _EVENT_LOOP_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Queue Depth , Power of 2 ( 3.2 s of Service Ticks While Main Loop is Busy ) */
+#define EVENT_LOOP_QUEUE_SIZE		32u
+#define EVENT_LOOP_QUEUE_MASK		(EVENT_LOOP_QUEUE_SIZE - 1u)
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+/* Queue Slot , Sequence Tells Who Owns it :
+ *
+ *   Sequence == Position                         => Free , Next Producer Reaching Position May Reserve it
+ *   Sequence == Position + 1                     => Event Written , Consumer May Take it
+ *   Sequence == Position + EVENT_LOOP_QUEUE_SIZE => Taken , Free For Next Turn Around The Ring
+ */
+typedef struct
+{
+	volatile uint32_t Sequence;
+	EVENT_t Event;
+
+} EventLoop_Slot_t;
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS PROTOTYPES SECTION                   *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Pop
+ * @brief			:	Take Oldest Event From The Queue
+ * @param			:	Event => Receives The Event
+ * @retval			:	Error State ( NOK if No Event is Ready )
+ * ======================================================================================*/
+static Error_State_t EventLoop_Pop(EVENT_t *Event);
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Run
+ * @brief			:	Run Handler of an Event if Any is Subscribed
+ * @param			:	Event => Event to Handle
+ * @retval			:	void
+ * ======================================================================================*/
+static void EventLoop_Run(const EVENT_t *Event);
+
+#endif /* _EVENT_LOOP_PRIVATE_H_ */
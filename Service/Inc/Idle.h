@@ -0,0 +1,51 @@
+/*
+ ******************************************************************************
+ * @file           : Idle.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Tickless Idle Manager Header File
+ * @Date           : Sep 4, 2023
+ ******************************************************************************
+ */
+#ifndef INC_IDLE_H_
+#define INC_IDLE_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Sleep Bounded Only by Timers & Periodic Call Back */
+#define IDLE_NO_LIMIT				0xFFFFFFFFul
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Idle_Enter
+ * @brief			:	Sleep Till Next Interrupt Unless an Event is Already Queued , Ticks With
+ * 						No Work Are Suppressed Meanwhile
+ * @param			:	MaxMs => Longest Sleep , IDLE_NO_LIMIT if Only Timers Bound it
+ * @retval			:	void
+ * @note			:	Thread Mode Only , Called by Main Loop When it Has Nothing to Dispatch
+ * ======================================================================================*/
+void Idle_Enter(uint32_t MaxMs);
+
+/*=======================================================================================
+ * @fn		 		:	Idle_GetPercent
+ * @brief			:	Share of Time Core Slept Since Previous Call ( Since Boot on First Call )
+ * @param			:	void
+ * @retval			:	Idle Percentage ( 0 - 100 ) , CPU Headroom
+ * @note			:	Thread Mode Only
+ * ======================================================================================*/
+uint8_t Idle_GetPercent(void);
+
+/*=======================================================================================
+ * @fn		 		:	Idle_GetIdleUs
+ * @brief			:	Total Time Core Slept Since Boot
+ * @param			:	void
+ * @retval			:	Idle Microseconds
+ * @note			:	Thread Mode Only
+ * ======================================================================================*/
+uint64_t Idle_GetIdleUs(void);
+
+#endif /* INC_IDLE_H_ */
@@ -0,0 +1,18 @@
+/*
+ ******************************************************************************
+ * @file           : Idle_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Tickless Idle Manager Private Header file
+ * @Date           : Sep 4, 2023
+ ******************************************************************************
+ */
+#ifndef _IDLE_PRIVATE_H_
+#define _IDLE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define IDLE_FULL_PERCENT			100u
+
+#endif /* _IDLE_PRIVATE_H_ */
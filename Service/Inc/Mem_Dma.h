@@ -0,0 +1,78 @@
+/*
+ ******************************************************************************
+ * @file           : Mem_Dma.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : DMA2 Memory Copy & Fill Service Header File
+ * @Date           : Aug 31, 2023
+ ******************************************************************************
+ */
+#ifndef INC_MEM_DMA_H_
+#define INC_MEM_DMA_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Requests Shorter Than That Are Done by CPU Right Away , DMA Setup Costs More Than The Copy Itself */
+#define MEM_DMA_SYNC_THRESHOLD		32u
+
+/* Largest Request in One Transfer ( NDTR is 16 Bits , Counted in Bytes When Not Word Aligned ) */
+#define MEM_DMA_MAX_SIZE			0xFFFFu
+
+/* ========================================================================= *
+ *                              ENUMS SECTION                                *
+ * ========================================================================= */
+
+typedef enum
+{
+	MEM_DMA_IDLE = 0,		/* Ready For a New Request */
+	MEM_DMA_BUSY,			/* Transfer Running on DMA2 */
+	MEM_DMA_ERROR			/* Last Transfer Ended With a Bus Error */
+
+} MEM_DMA_STATE_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Init
+ * @brief			:	Reserve a Free DMA2 Stream For Memory to Memory Transfers & Enable its Interrupt
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Every DMA2 Stream is Taken )
+ * ======================================================================================*/
+Error_State_t MemDma_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Copy
+ * @brief			:	Copy a Memory Block , Word Sized With Bursts Through FIFO When Both Ends Allow it
+ * @param			:	Destination => Where to Copy
+ * @param			:	Source => What to Copy
+ * @param			:	Size => Number of Bytes ( Max MEM_DMA_MAX_SIZE )
+ * @param			:	CallBack => Called When Copy is Done or Failed ( Check MemDma_GetState ) , May be NULL
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * @note			:	Below MEM_DMA_SYNC_THRESHOLD Copy is Done & CallBack is Called Before Return
+ * ======================================================================================*/
+Error_State_t MemDma_Copy(void *Destination, const void *Source, uint32_t Size, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Fill
+ * @brief			:	Fill a Memory Block With One Byte Value
+ * @param			:	Destination => Block to Fill
+ * @param			:	Value => Fill Byte
+ * @param			:	Size => Number of Bytes ( Max MEM_DMA_MAX_SIZE )
+ * @param			:	CallBack => Called When Fill is Done or Failed ( Check MemDma_GetState ) , May be NULL
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * @note			:	Below MEM_DMA_SYNC_THRESHOLD Fill is Done & CallBack is Called Before Return
+ * ======================================================================================*/
+Error_State_t MemDma_Fill(void *Destination, uint8_t Value, uint32_t Size, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_GetState
+ * @brief			:	Report State of The Memory DMA Stream
+ * @param			:	State => Pointer to Variable to Hold The State
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t MemDma_GetState(MEM_DMA_STATE_t *State);
+
+#endif /* INC_MEM_DMA_H_ */
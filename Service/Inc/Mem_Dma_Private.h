@@ -0,0 +1,72 @@
+/*
+ ******************************************************************************
+ * @file           : Mem_Dma_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : DMA2 Memory Copy & Fill Service Private Header file
+ * @Date           : Aug 31, 2023
+ ******************************************************************************
+ */
+#ifndef _MEM_DMA_PRIVATE_H_
+#define _MEM_DMA_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* DMA2 Stream Interrupts , Not Contiguous in Vector Table */
+#define MEM_DMA_STREAMS_IRQS	{DMA2_Stream0_IRQ, DMA2_Stream1_IRQ, DMA2_Stream2_IRQ, DMA2_Stream3_IRQ, \
+								 DMA2_Stream4_IRQ, DMA2_Stream5_IRQ, DMA2_Stream6_IRQ, DMA2_Stream7_IRQ}
+
+/* Word Transfers Need Both Addresses & Size on a 4 Bytes Boundary */
+#define MEM_DMA_WORD_ALIGN		4u
+
+/* Bursts Move 16 Bytes ( 4 Words or 16 Bytes = Full FIFO ) & Must Not Cross a 1 KB Boundary ,
+ * Keeping Addresses & Size on a 16 Bytes Boundary Guarantees That */
+#define MEM_DMA_BURST_ALIGN		16u
+
+#define MEM_DMA_IS_ALIGNED(VALUE, ALIGN)	((((uint32_t)(VALUE)) & ((ALIGN) - 1u)) == 0u)
+
+/* Fill Byte Replicated in a Word */
+#define MEM_DMA_FILL_WORD(VALUE)	((uint32_t)(VALUE) * 0x01010101UL)
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS PROTOTYPES SECTION                   *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Claim
+ * @brief			:	Mark The Stream Busy if it is Free
+ * @param			:	void
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * ======================================================================================*/
+static Error_State_t MemDma_Claim(void);
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Start
+ * @brief			:	Shape The Claimed Stream For a Request & Start it
+ * @param			:	Destination => Where to Write
+ * @param			:	Source => Where to Read
+ * @param			:	Size => Number of Bytes
+ * @param			:	SourceInc => DMA_PINC_DISABLE For Fill , DMA_PINC_ENABLE For Copy
+ * @param			:	CallBack => Completion Call Back
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t MemDma_Start(void *Destination, const void *Source, uint32_t Size, DMA_PINC_t SourceInc, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Complete
+ * @brief			:	Transfer Complete Call Back , Frees The Stream & Calls User Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void MemDma_Complete(void);
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Error
+ * @brief			:	Transfer Error Call Back , Stops The Stream & Calls User Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void MemDma_Error(void);
+
+#endif /* _MEM_DMA_PRIVATE_H_ */
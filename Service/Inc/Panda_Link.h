@@ -0,0 +1,231 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Link.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Panda Board SPI Link Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_PANDA_LINK_H_
+#define INC_PANDA_LINK_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Frame Layout Sent to Panda Board :
+ *
+ *   | OPCODE | LENGTH | PAYLOAD ( LENGTH Bytes ) | CRC8 ( Optional ) |
+ *
+ * CRC8 ( Polynomial 0x07 , Initial Value 0x00 ) Covers OPCODE , LENGTH & PAYLOAD
+ */
+#define PANDA_LINK_HEADER_SIZE			2u
+#define PANDA_LINK_MAX_PAYLOAD_SIZE		28u
+
+/* Link CRC Modes */
+#define PANDA_LINK_CRC_NONE				0u		/* No Integrity Check */
+#define PANDA_LINK_CRC_SW				1u		/* CRC8 Calculated by Software & Appended to The Frame */
+#define PANDA_LINK_CRC_HW				2u		/* CRC Appended by SPI1 CRC Unit , Panda Answers Every Frame With a Status Byte */
+
+/* Selected CRC Mode , Panda Board Must Use The Same Setting ( May be Given on Compiler Command Line ) */
+#ifndef PANDA_LINK_CRC
+#define PANDA_LINK_CRC					PANDA_LINK_CRC_NONE
+#endif
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_SW
+#define PANDA_LINK_CRC_SIZE				1u
+#else
+#define PANDA_LINK_CRC_SIZE				0u
+#endif
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+/* Errors Are Detected & Repaired , So SPI1 May Run Faster */
+#define PANDA_LINK_SPI_CRC_STATE		CRC_STATE_ENABLED
+#define PANDA_LINK_SPI_BAUDRATE			BAUDRATE_FpclkBY16
+#else
+#define PANDA_LINK_SPI_CRC_STATE		CRC_STATE_DISABLED
+#define PANDA_LINK_SPI_BAUDRATE			BAUDRATE_FpclkBY256
+#endif
+
+/* SPI CRC Polynomial ( CRCPR ) Used in PANDA_LINK_CRC_HW Mode */
+#define PANDA_LINK_HW_CRC_POLYNOMIAL	0x07u
+
+/* Status Byte Clocked Back From Panda After Every Frame in PANDA_LINK_CRC_HW Mode */
+#define PANDA_STATUS_ACK				0x06u
+#define PANDA_STATUS_NAK				0x15u
+
+/* Times a Frame is Sent Again After NAK ( or No Answer ) Before it is Dropped */
+#define PANDA_LINK_MAX_RETRIES			3u
+
+#define PANDA_LINK_MAX_FRAME_SIZE		(PANDA_LINK_HEADER_SIZE + PANDA_LINK_MAX_PAYLOAD_SIZE + PANDA_LINK_CRC_SIZE)
+
+/* Frames Waiting Per Priority Level , SendFrame Returns NOK When Level is Full */
+#define PANDA_LINK_QUEUE_DEPTH			4u
+
+/* Speed Calibration : Pattern Bytes Echoed by Panda , Rounds Per Prescaler & Frame Wait Limit
+ * ( Milliseconds , an Echo Frame Takes About 1.3 ms at Fpclk/256 ) */
+#define PANDA_LINK_CALIB_PATTERN_SIZE	8u
+#define PANDA_LINK_CALIB_ROUNDS			4u
+#define PANDA_LINK_CALIB_TIMEOUT_MS		10u
+
+/* Display Payload : Seconds , Minutes , Hours , Day , Month , Year , Date */
+#define PANDA_DISPLAY_PAYLOAD_SIZE		7u
+
+/* Reply Clocked Back During Every Frame : Verdict on Previous Frame Then Panda Events ( One Per Byte ) */
+#define PANDA_REPLY_STATUS_INDEX		0u
+#define PANDA_REPLY_EVENTS_INDEX		1u
+
+/* Panda Events , High Nibble is The Type & Low Nibble is The Argument */
+#define PANDA_EVENT_NONE				0x00u
+#define PANDA_EVENT_ALARM_ACK			0x40u	/* | Alarm Number , User Silenced That Alarm on Panda */
+#define PANDA_EVENT_BUTTON				0x80u	/* | Button Number */
+#define PANDA_EVENT_TYPE_MASK			0xF0u
+#define PANDA_EVENT_ARG_MASK			0x0Fu
+
+/* Panda Buttons */
+#define PANDA_BUTTON_SILENCE			1u
+#define PANDA_BUTTON_SNOOZE				2u
+
+/* ========================================================================= *
+ *                              ENUMS SECTION                                *
+ * ========================================================================= */
+
+/* Opcodes Understood by Panda Board ( Values Kept From The Old Fixed Frames ) */
+typedef enum
+{
+	PANDA_OPCODE_RED_LED = 0x39,
+	PANDA_OPCODE_DISPLAY = 0x41,
+	PANDA_OPCODE_GREEN_LED = 0x44,
+	PANDA_OPCODE_ECHO = 0x45,			/* Panda Sends The Payload Back in The Next Transaction */
+	PANDA_OPCODE_DISPLAY_DELTA = 0x46,	/* Field Mask Followed by Changed Display Fields Only */
+	PANDA_OPCODE_ALARM = 100
+
+} PANDA_OPCODE_t;
+
+/* Devices Sharing SPI1 , Each Selected by its Own GPIO NSS Line */
+typedef enum
+{
+	PANDA_DEVICE_STATUS = 0,	/* Status Display */
+	PANDA_DEVICE_WALL,			/* Wall Display */
+	PANDA_BOARDS_NUMBER,
+
+	PANDA_DEVICE_CLOCK_NODE = PANDA_BOARDS_NUMBER,	/* Slave Clock Node ( Clock_Node.h ) , Takes Node Frames Only */
+	PANDA_DEVICES_NUMBER,
+
+	PANDA_DEVICE_BROADCAST = PANDA_DEVICES_NUMBER	/* Every Panda Board , One After The Other */
+
+} PANDA_DEVICE_t;
+
+/* Transmit Priority , Lower Value is Sent First */
+typedef enum
+{
+	PANDA_PRIORITY_ALARM = 0,
+	PANDA_PRIORITY_DISPLAY,
+	PANDA_PRIORITY_STATUS,
+	PANDA_PRIORITY_LEVELS
+
+} PANDA_PRIORITY_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Init
+ * @brief			:	Configure NSS Lines of Every Device in The Device Table
+ * @param			:	void
+ * @retval			:	Error State
+ * @note			:	Called Before Any Frame is Sent & After EventLoop_Init
+ * ======================================================================================*/
+Error_State_t PandaLink_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EncodeFrame
+ * @brief			:	Build a Frame ( Opcode , Length , Payload , CRC8 if Enabled )
+ * @param			:	Opcode => Frame Opcode
+ * @param			:	Payload => Payload Bytes ( May be NULL if Length is 0 )
+ * @param			:	Length => Number of Payload Bytes ( Max PANDA_LINK_MAX_PAYLOAD_SIZE )
+ * @param			:	Frame => Buffer of at Least PANDA_LINK_MAX_FRAME_SIZE Bytes
+ * @param			:	FrameSize => Number of Bytes Written in Frame
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t PandaLink_EncodeFrame(PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, uint8_t *Frame, uint8_t *FrameSize);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendFrame
+ * @brief			:	Encode a Frame & Queue it For Every Panda Board Through SPI1 DMA ,
+ * 						Queued Frames are Sent Back to Back ( Alarm > Display > Status ) From
+ * 						DMA Completion Interrupt , Safe to Call From Thread or ISR Context
+ * @param			:	Opcode => Frame Opcode ( Selects The Priority )
+ * @param			:	Payload => Payload Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Length => Number of Payload Bytes
+ * @param			:	CallBack => Function Called When Frame is Transmitted to All Boards
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendFrame(PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendFrameTo
+ * @brief			:	Same as PandaLink_SendFrame For One Board , Every Board Has its Own Queues
+ * 						Served Round Robin Within a Priority Level
+ * @param			:	Device => Target Board or PANDA_DEVICE_BROADCAST
+ * @param			:	Opcode => Frame Opcode ( Selects The Priority )
+ * @param			:	Payload => Payload Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Length => Number of Payload Bytes
+ * @param			:	CallBack => Function Called When Frame is Transmitted to Every Target Board
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendFrameTo(PANDA_DEVICE_t Device, PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendEncodedTo
+ * @brief			:	Queue a Frame Already Encoded by Caller ( Clock Node Frames Carry Their Own CRC8 )
+ * 						For One Device
+ * @param			:	Device => Target Device
+ * @param			:	Priority => Transmit Priority
+ * @param			:	Frame => Frame Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Size => Number of Frame Bytes ( Max PANDA_LINK_MAX_FRAME_SIZE )
+ * @param			:	CallBack => Function Called When Frame is Transmitted
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendEncodedTo(PANDA_DEVICE_t Device, PANDA_PRIORITY_t Priority, const uint8_t *Frame, uint8_t Size, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SetEventCallBack
+ * @brief			:	Set Function Receiving Panda Events Clocked Back in Frame Replies
+ * @param			:	CallBack => Called From DMA Completion Interrupt ( Thread Mode With PANDA_LINK_CRC_HW )
+ * 						With Every Event Byte
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t PandaLink_SetEventCallBack(void (*CallBack)(uint8_t Event));
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_GetFrameState
+ * @brief			:	Delivery State of The Frame Whose Call Back is Running
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Panda Never Acknowledged it , Without PANDA_LINK_CRC_HW NOK
+ * 						Means Panda Rejected The Previous Display Frame )
+ * @note			:	Valid Only Inside Frame Call Back
+ * ======================================================================================*/
+Error_State_t PandaLink_GetFrameState(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Calibrate
+ * @brief			:	Step SPI Prescaler Down From Fpclk/256 Toward Fpclk/2 Exchanging Echo Patterns
+ * 						With Every Panda Board , Locks in The Fastest Prescaler All of Them Pass
+ * @param			:	SPI_Config => SPI1 Configuration , BaudRate_Value is Updated With The Result
+ * @retval			:	Error State ( NOK if Panda Fails Even at Fpclk/256 , Prescaler is Left at Fpclk/256 )
+ * @note			:	Blocking , Called at Boot After Timebase , SPI1 & its DMA Are Initialized
+ * ======================================================================================*/
+Error_State_t PandaLink_Calibrate(SPI_CONFIGS_t *SPI_Config);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_CRC8
+ * @brief			:	Calculate CRC8 ( Polynomial 0x07 ) of a Buffer
+ * @param			:	Data => Buffer
+ * @param			:	Size => Number of Bytes
+ * @retval			:	CRC8 Value
+ * ======================================================================================*/
+uint8_t PandaLink_CRC8(const uint8_t *Data, uint8_t Size);
+
+#endif /* INC_PANDA_LINK_H_ */
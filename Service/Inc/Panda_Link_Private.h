@@ -0,0 +1,185 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Link_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Panda Board SPI Link Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _PANDA_LINK_PRIVATE_H_
+#define _PANDA_LINK_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define PANDA_LINK_OPCODE_INDEX		0u
+#define PANDA_LINK_LENGTH_INDEX		1u
+
+#define PANDA_LINK_CRC8_POLYNOMIAL	0x07u
+#define PANDA_LINK_CRC8_INIT		0x00u
+
+/* Device Table NSS Lines */
+#define PANDA_STATUS_NSS_PORT		PORTA
+#define PANDA_STATUS_NSS_PIN		PIN4
+#define PANDA_WALL_NSS_PORT			PORTA
+#define PANDA_WALL_NSS_PIN			PIN8
+#define PANDA_CLOCK_NODE_NSS_PORT	PORTA
+#define PANDA_CLOCK_NODE_NSS_PIN	PIN9
+
+/* Byte Sent While Panda Clocks Back its Status in PANDA_LINK_CRC_HW Mode */
+#define PANDA_LINK_STATUS_FILL		0xFFu
+
+/* Device Queues Then Broadcast Queue */
+#define PANDA_LINK_QUEUES			(PANDA_DEVICES_NUMBER + 1u)
+
+/* Slot Device Mask of Broadcast Frames , Clock Node is Left Out */
+#define PANDA_LINK_ALL_BOARDS		((uint8_t)((1u << PANDA_BOARDS_NUMBER) - 1u))
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+/* One Encoded Frame Waiting ( or in Flight ) With its Target Devices & Owner Call Back */
+typedef struct
+{
+	uint8_t Frame[PANDA_LINK_MAX_FRAME_SIZE];
+	uint8_t Size;
+	uint8_t Retries;
+	uint8_t Devices;		/* Bit Per Device Still Waiting For The Frame */
+	Error_State_t State;	/* NOK if Any Device Did Not Acknowledge it */
+	void (*CallBack)(void);
+
+} PandaLink_Slot_t;
+
+/* Ring of Frames of One Priority Level , Head is The Oldest Frame */
+typedef struct
+{
+	PandaLink_Slot_t Slots[PANDA_LINK_QUEUE_DEPTH];
+	uint8_t Head;
+	uint8_t Count;
+
+} PandaLink_Queue_t;
+
+/* Last Frame Sent to a Device , That Device Judges it in The Reply of Its Next Frame */
+typedef struct
+{
+	PandaLink_Slot_t Slot;
+	PANDA_PRIORITY_t Priority;
+	uint8_t ValidFlag;
+
+} PandaLink_Prev_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_TxDone
+ * @brief			:	SPI1 DMA Call Back , Routes Panda Events & Completes The Sent Frame , With
+ * 						PANDA_LINK_CRC_HW The Status Transaction is Started From Thread Mode
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_TxDone(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_RouteEvents
+ * @brief			:	Pass Every Event Byte of The Reply to Panda Event Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_RouteEvents(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_FrameDone
+ * @brief			:	Release The Sent Slot ( or Keep it For Retransmit ) , Start The Next Frame
+ * 						& Notify Frame Owner
+ * @param			:	Status => Panda Status Byte of The Sent Frame , Only Used With PANDA_LINK_CRC_HW
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_FrameDone(uint8_t Status);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StartNext
+ * @brief			:	Start DMA on The Oldest Frame of The Highest Non Empty Priority Level
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Must be Called With Interrupts Masked or From PandaLink_TxDone
+ * ======================================================================================*/
+static void PandaLink_StartNext(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_GetPriority
+ * @brief			:	Map Frame Opcode to its Transmit Priority
+ * @param			:	Opcode => Frame Opcode
+ * @retval			:	Priority Level
+ * ======================================================================================*/
+static PANDA_PRIORITY_t PandaLink_GetPriority(PANDA_OPCODE_t Opcode);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Push
+ * @brief			:	Hand Tail Slot of a Queue ( Frame Already Written ) to Its Target Devices
+ * @param			:	Queue => Device or Broadcast Queue of One Priority Level
+ * @param			:	Device => Target Device or PANDA_DEVICE_BROADCAST
+ * @param			:	CallBack => Frame Owner Call Back
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_Push(PandaLink_Queue_t *Queue, PANDA_DEVICE_t Device, void (*CallBack)(void));
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Requeue
+ * @brief			:	Put Copy of Frame Rejected by a Panda Board Back at Head of That Board Queue
+ * @param			:	Device => Board That Rejected its Previous Frame
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_Requeue(PANDA_DEVICE_t Device);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Resent
+ * @brief			:	Call Back of Requeued Frames
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_Resent(void);
+#endif
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EchoTest
+ * @brief			:	Send Test Patterns in Echo Frames & Check What Panda Clocks Back
+ * @param			:	Device => Board Under Test
+ * @retval			:	Error State ( OK if All Rounds Match )
+ * ======================================================================================*/
+static Error_State_t PandaLink_EchoTest(PANDA_DEVICE_t Device);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EchoSent
+ * @brief			:	Call Back of Echo Frames , Releases PandaLink_EchoTest
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_EchoSent(void);
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StatusHandler
+ * @brief			:	EVENT_PANDA_STATUS Handler , Routes Reply Events if Their CRC Matched , Ends
+ * 						The Frame Transaction ( Panda Checks its CRC ) & Starts The One Byte Status
+ * 						Transaction
+ * @param			:	Event => Unused
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_StatusHandler(const EVENT_t *Event);
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StatusDone
+ * @brief			:	SPI1 DMA Call Back of The Status Transaction , Completes The Frame With
+ * 						The Status Byte Panda Clocked Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_StatusDone(void);
+#endif
+
+#endif /* _PANDA_LINK_PRIVATE_H_ */
@@ -17,6 +17,26 @@
 
 #define NUM_OF_TRIES 0x03
 
+/* SysTick Period Driving Background Services ( Display Stream , Alarm Check ) */
+#define SERVICE_TICK_MS 100u
+
+/* ENABLED to Print SPI1 Throughput at Every Prescaler on Boot */
+#define SPI1_BENCHMARK DISABLED
+
+/* ENABLED to Follow a Master Clock on SPI2 ( Time & Alarm Table Frames ) as a Slave Clock Node */
+#define CLOCK_NODE ENABLED
+
+/* Rows of Alarm Table ( Hours , Minutes , Seconds Each ) , Clock Node Frames Carry The Whole Table */
+#define ALARMS_NUMBER 5u
+
+/* Accepted Date & Time Fields , From User & From Master Clock */
+#define MAX_DATE 31u
+#define MAX_HOURS 23u
+#define MAX_MINUTES 59u
+#define MAX_SECONDS 59u
+#define MAX_MONTH 12u
+#define MAX_YEAR 99u
+
 typedef enum
 {
 	NO_OPTION = 0x00,
@@ -62,6 +82,48 @@ void USART2_Init(void);
  * ======================================================================================*/
 void SPI1_Init(void);
 
+/*=======================================================================================
+ * @fn		 		:	SPI1_DMA_Init
+ * @brief			:	Initialize DMA2 Stream3 Channel3 to Feed SPI1 Tx Buffer & DMA2 Stream0
+ * 						Channel3 to Drain SPI1 Rx Buffer
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void SPI1_DMA_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Transmit_DMA
+ * @brief			:	Transmit Buffer of data via SPI1 Using DMA & Optionally Receive What Slave
+ * 						Clocks Back Meanwhile , Call Back is Called Once When the Whole Buffer is
+ * 						Moved ( And The Reply is Received )
+ * @param			:	Frame => Buffer to Send ( Must Stay Valid Till Call Back )
+ * @param			:	Reply => Buffer of Size Bytes For Received Data , NULL to Drop it
+ * @param			:	Size => Number of Bytes to Send
+ * @param			:	CallBack => Function Called When Transfer is Done
+ * @retval			:	Error State ( NOK if a Frame is Still in Flight )
+ * ======================================================================================*/
+Error_State_t SPI1_Transmit_DMA(uint8_t *Frame, uint8_t *Reply, uint16_t Size, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Calibrate
+ * @brief			:	Find The Fastest SPI1 Prescaler Panda Board Follows Reliably , Store it in
+ * 						DS1307 RAM & Report it on The Console , Stored Value is Used if Panda
+ * 						Does Not Answer
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called at Boot After SPI1 , its DMA , I2C1 & USART2 Are Initialized
+ * ======================================================================================*/
+void SPI1_Calibrate(void);
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Benchmark
+ * @brief			:	Measure Polled Full Duplex SPI1 Throughput at Every Prescaler & Report it
+ * 						on The Console in Bytes Per Second
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void SPI1_Benchmark(void);
+
 /*=======================================================================================
  * @fn		 		:	I2C1_Init
  * @brief			:	Initialize I2C1
@@ -209,7 +271,7 @@ void WRONG_OptionChoosen(void);
  *
  * @brief 			: This Function is Called Inside Call Back Function of SPI ,
  *                    When Number of Tries of User is Finished &
- *                    RED_LED_CODE is Transmitted to the Blue Pill Board ,
+ *                    Red LED Frame is Transmitted to the Blue Pill Board ,
  *                    This Function is Called to Execute the Shutdown Sequence
  *
  * @param[in]		: void
@@ -230,7 +292,7 @@ void Reading_Time(void);
 
 /*=======================================================================================
  * @fn		 		:	Transmit_Time
- * @brief			:	Transmit Buffer of data via SPI (with interrupt)
+ * @brief			:	Transmit Buffer of data via SPI (with DMA)
  * @param			:	void
  * @retval			:	void
  * ======================================================================================*/
@@ -252,11 +314,36 @@ void SetAlarm();
 void CalcAlarm(uint8_t AlarmNumber);
 
 /*==============================================================================================================================================
- *@fn      :  void CompTime()
+ *@fn      :  void CompTime(const DS1307_Config_t *RecievedTime)
  *@brief  :   This Function Is Responsible For Comparing The Current Time With The Alarm Time And Send The Alarm Number To The Blue Pill If They Are Equal
+ *@paramter[in]  : const DS1307_Config_t *RecievedTime : Current Time Read From The RTC by The Caller
  *@retval void :
  *==============================================================================================================================================*/
-void CompTime();
+void CompTime(const DS1307_Config_t *RecievedTime);
+
+/*==============================================================================================================================================
+ *@fn      :  void AlarmEvent(uint8_t Event)
+ *@brief  :   Panda Event Call Back , Silences Ringing Alarms When User Acknowledges Them or Presses Silence Button ,
+ *            Snooze Button Rings Them Again ALARM_SNOOZE_MINUTES Later Without Touching AlarmTime
+ *@paramter[in]  : uint8_t Event : Event Byte Clocked Back by Panda
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmEvent(uint8_t Event);
+
+/*==============================================================================================================================================
+ *@fn      :  void AlarmSend(uint8_t AlarmIndex)
+ *@brief  :   Sends The Alarm Number & Name To Panda , SPI1_ISR is Called Once The Frame is Out
+ *@paramter[in]  : uint8_t AlarmIndex : Index Of The Ringing Alarm
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmSend(uint8_t AlarmIndex);
+
+/*==============================================================================================================================================
+ *@fn      :  void AlarmPulse_Start()
+ *@brief  :   Starts The Alarm Pulse to Blue Pill Board , it Ends by Itself After ALARM_PULSE_MS
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmPulse_Start(void);
 
 /*==============================================================================================================================================
  *@fn      :  void SendGreenSignal()
@@ -285,16 +372,39 @@ void SPI_CALL_BACK(void);
 
 /*==============================================================================================================================================
  *@fn      :  void SPI1_ISR()
- *@brief   :  This Function Is ISR For SPI In Case Of Alarm is Triggered to Send Inside the Call Back , Pulse to the Blue Pill Board
+ *@brief   :  Alarm Frame Call Back , Posts EVENT_SPI_DONE So Main Loop Starts The Pulse to the Blue Pill Board
  *@retval  :  void
  *==============================================================================================================================================*/
 void SPI1_ISR();
 
+/*==============================================================================================================================================
+ *@fn      :  void SPI1_DMA_TXC_Handler()
+ *@brief   :  DMA2 Stream3 Call Back , Called Once the Whole Frame is Moved to SPI1 , Calls the Call Back of the Frame Owner
+ *@retval  :  void
+ *==============================================================================================================================================*/
+void SPI1_DMA_TXC_Handler(void);
+
+/*==============================================================================================================================================
+ *@fn      :  void SPI1_DMA_RXC_Handler()
+ *@brief   :  DMA2 Stream0 Call Back ( & Error Call Back of Both Streams ) , Called Once the Whole Reply is Received ,
+ *            Ends The Transfer & Calls the Call Back of the Frame Owner
+ *@retval  :  void
+ *==============================================================================================================================================*/
+void SPI1_DMA_RXC_Handler(void);
+
 /*==============================================================================================================================================
  *@fn      : void SysTickPeriodicISR()
- *@brief  :  This Function Is The ISR For The SYSTICK Interrupt , It Is Responsible For Calling The CompTime Function Every One Second
+ *@brief  :  This Function Is The ISR For The SYSTICK Interrupt , Comes Every SERVICE_TICK_MS , Posts EVENT_SERVICE_TICK Only
  *@retval void :
  *==============================================================================================================================================*/
 void SysTickPeriodicISR();
 
+/*==============================================================================================================================================
+ *@fn      : void PandaEvent_ISR(uint8_t Event)
+ *@brief  :  Panda Link Event Call Back ( DMA Interrupt ) , Posts EVENT_PANDA_INPUT Only
+ *@paramter[in]  : uint8_t Event : Event Byte Clocked Back by Panda
+ *@retval void :
+ *==============================================================================================================================================*/
+void PandaEvent_ISR(uint8_t Event);
+
 #endif /* INC_SERVICE_H_ */
@@ -20,31 +20,35 @@
 
 #define CLEAR_TERMINAL "\033\143"
 
-#define DELAY_1s()                      \
-    for (uint16_t n = 1000; n > 0; n--) \
-        for (uint16_t y = 0; y < 3195; y++)
-
-#define DELAY_500ms()                  \
-    for (uint16_t n = 500; n > 0; n--) \
-        for (uint16_t i = 0; i < 3195; i++)
-
-#define RED_LED_CODE 0x39
-#define DISPLAY_CODE 0x41
-#define GREEN_LED_CODE 0x44
-#define ALARMCODE 100
+/* Pause Letting User Read The Terminal Before it Changes */
+#define TERMINAL_PAUSE_MS 500u
+
+/* Width of Alarm Pulse to Blue Pill Board */
+#define ALARM_PULSE_MS 500u
+
+/* SPI1 Calibration Record in DS1307 RAM : Magic , Prescaler , Inverted Prescaler */
+#define SPI1_CALIB_RAM_OFFSET 0u
+#define SPI1_CALIB_RECORD_SIZE 3u
+#define SPI1_CALIB_MAGIC 0xC5u
+
+/* SPI1 Throughput Benchmark Block & Console Line Layout */
+#define SPI1_BENCH_BLOCK_SIZE 64u
+#define SPI1_BENCH_DIVISOR_END 10u
+#define SPI1_BENCH_DIVISOR_DIGITS 3u
+#define SPI1_BENCH_RATE_END 21u
+#define SPI1_BENCH_RATE_DIGITS 8u
+
+/* Alarm Engine : Reminder Period & Count While Not Silenced , Snooze Delay */
+#define ALARM_REPEAT_SECONDS 10u
+#define ALARM_MAX_REPEATS 6u
+#define ALARM_SNOOZE_MINUTES 5u
+#define ALARM_SNOOZE_MS (ALARM_SNOOZE_MINUTES * 60000ul)
 
 #define FIRST_LETTER_OF_DAY 10u
 #define SECOND_LETTER_OF_DAY 11u
 #define THIRD_LETTER_OF_DAY 12u
 #define WRONG_DAY 8u
 
-#define MAX_DATE 31u
-#define MAX_HOURS 23u
-#define MAX_MINUTES 59u
-#define MAX_SECONDS 59u
-#define MAX_MONTH 12u
-#define MAX_YEAR 99u
-
 #define Filling                                                                                              \
     {                                                                                                        \
         {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, { 0xFF, 0xFF, 0xFF } \
@@ -157,4 +161,62 @@ static void Calculate_Calender(DS1307_Config_t *Date_Time_To_RTC, uint8_t *Date_
  * ======================================================================================*/
 static Error_State_t Check_Calender(DS1307_Config_t *Date_Time_To_RTC);
 
+/*=======================================================================================
+ * @fn		 		:	Fill_Decimal
+ * @brief			:	Write Number Right Aligned in a Blank Message Field
+ * @param			:	Field_End => Last Character of The Field
+ * @param			:	Value => Number to Write
+ * @param			:	Width => Field Width , Higher Digits Are Dropped
+ * @retval			:	void
+ * ======================================================================================*/
+static void Fill_Decimal(char *Field_End, uint32_t Value, uint8_t Width);
+
+/*=======================================================================================
+ * @fn		 		:	Terminal_Receive
+ * @brief			:	Wait For a Character From Terminal , Queued Events Are Handled Meanwhile
+ * @param			:	void
+ * @retval			:	Received Character
+ * ======================================================================================*/
+static uint16_t Terminal_Receive(void);
+
+/*=======================================================================================
+ * @fn		 		:	Terminal_Pause
+ * @brief			:	Pause Terminal Output , Queued Events Are Handled Meanwhile
+ * @param			:	PauseMs => Pause in Milliseconds
+ * @retval			:	void
+ * ======================================================================================*/
+static void Terminal_Pause(uint32_t PauseMs);
+
+/*=======================================================================================
+ * @fn		 		:	Terminal_Received
+ * @brief			:	USART2 Receive Call Back , Posts The Character
+ * @param			:	Data => Received Character
+ * @retval			:	void
+ * ======================================================================================*/
+static void Terminal_Received(uint16_t Data);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPulse_End
+ * @brief			:	Alarm Pulse Timer Call Back , Ends The Pulse to Blue Pill Board
+ * @param			:	Context => Unused
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmPulse_End(void *Context);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmSnooze_End
+ * @brief			:	Alarm Snooze Timer Call Back , Marks The Alarm Due to Ring Again
+ * @param			:	Context => Alarm Index
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmSnooze_End(void *Context);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmSnooze_Cancel
+ * @brief			:	Drop a Pending Snooze of an Alarm , Counting or Already Due
+ * @param			:	AlarmIndex => Index of The Alarm
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmSnooze_Cancel(uint8_t AlarmIndex);
+
 #endif /* _SERVICE_PRIVATE_H_ */
@@ -0,0 +1,136 @@
+/*
+ ******************************************************************************
+ * @file           : Timebase.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SysTick & DWT System Timebase Header File
+ * @Date           : Sep 1, 2023
+ ******************************************************************************
+ */
+#ifndef INC_TIMEBASE_H_
+#define INC_TIMEBASE_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Core Clock From SYSTICK Driver ( SYSTICK_Interface.h ) , DWT Cycles Are Counted at That Rate */
+#define TIMEBASE_HCLK_HZ			SYSTICK_HCLK_HZ
+
+/* SysTick Period , Uptime Resolution */
+#define TIMEBASE_TICK_MS			1u
+
+/* Longest Tickless Sleep , Its Cycles Must Fit 24 Bits SysTick Counter ( 16 M of 16.7 M ) */
+#define TIMEBASE_MAX_SLEEP_MS		1000u
+
+/* DWT Cycles to Nanoseconds ( 62.5 ns Per Cycle at 16 MHz ) */
+#define TIMEBASE_CYCLES_TO_NS(CYCLES)	(((uint64_t)(CYCLES) * 1000000000ull) / TIMEBASE_HCLK_HZ)
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Init
+ * @brief			:	Start SysTick at 1 kHz From AHB & DWT Cycle Counter , Uptime Starts at 0
+ * @param			:	void
+ * @retval			:	Error State
+ * @note			:	SysTick Belongs to Timebase From Now on , Periodic Work Goes Through Timebase_SetPeriodicCallBack
+ * ======================================================================================*/
+Error_State_t Timebase_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_SetPeriodicCallBack
+ * @brief			:	Call a Function From SysTick Interrupt Every Period
+ * @param			:	PeriodMs => Call Period in Milliseconds ( Not 0 )
+ * @param			:	CallBack => Function to Call
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t Timebase_SetPeriodicCallBack(uint32_t PeriodMs, void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Millis
+ * @brief			:	Milliseconds Since Timebase_Init , Never Wraps
+ * @param			:	void
+ * @retval			:	Uptime in Milliseconds
+ * ======================================================================================*/
+uint64_t Timebase_Millis(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Micros
+ * @brief			:	Microseconds Since Timebase_Init , Uptime Refined by SysTick Current Value
+ * @param			:	void
+ * @retval			:	Uptime in Microseconds
+ * @note			:	Stays Monotonic When Called With Interrupts Masked or From a Higher Priority
+ * 						Interrupt , as Long as Tick Interrupt is Held Back Less Than 1 ms
+ * ======================================================================================*/
+uint64_t Timebase_Micros(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Cycles
+ * @brief			:	DWT Core Cycle Counter , For Sub Microsecond Timestamps
+ * @param			:	void
+ * @retval			:	Cycle Count ( Wraps Every 2^32 Cycles , Use Timebase_ElapsedCycles )
+ * ======================================================================================*/
+uint32_t Timebase_Cycles(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedMs
+ * @brief			:	Milliseconds Passed Since a Timebase_Millis Timestamp
+ * @param			:	StartMs => Timestamp
+ * @retval			:	Elapsed Milliseconds
+ * ======================================================================================*/
+uint64_t Timebase_ElapsedMs(uint64_t StartMs);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedUs
+ * @brief			:	Microseconds Passed Since a Timebase_Micros Timestamp
+ * @param			:	StartUs => Timestamp
+ * @retval			:	Elapsed Microseconds
+ * ======================================================================================*/
+uint64_t Timebase_ElapsedUs(uint64_t StartUs);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedCycles
+ * @brief			:	Core Cycles Passed Since a Timebase_Cycles Timestamp , Correct Across One Wrap
+ * @param			:	StartCycles => Timestamp
+ * @retval			:	Elapsed Cycles
+ * ======================================================================================*/
+uint32_t Timebase_ElapsedCycles(uint32_t StartCycles);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Deadline
+ * @brief			:	Build a Deadline a Number of Milliseconds From Now
+ * @param			:	DelayMs => Milliseconds From Now
+ * @retval			:	Deadline , Check it With Timebase_IsExpired
+ * ======================================================================================*/
+uint64_t Timebase_Deadline(uint32_t DelayMs);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_IsExpired
+ * @brief			:	Non Blocking Check of a Deadline
+ * @param			:	Deadline => From Timebase_Deadline
+ * @retval			:	FLAG_SET if Deadline is Reached , Else FLAG_RESET
+ * ======================================================================================*/
+uint8_t Timebase_IsExpired(uint64_t Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_DelayMs
+ * @brief			:	Wait a Number of Milliseconds
+ * @param			:	DelayMs => Milliseconds to Wait
+ * @retval			:	void
+ * @note			:	Thread Mode Only , Needs Tick Interrupt to Run . Interrupts Use Deadlines Instead
+ * ======================================================================================*/
+void Timebase_DelayMs(uint32_t DelayMs);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Sleep
+ * @brief			:	Sleep Till Next Interrupt , Ticks With No Work Are Suppressed : SysTick is
+ * 						Reprogrammed to Fire at Next Timer Expiry or Periodic Call Back ( At Most MaxMs ) ,
+ * 						Uptime & Timer Wheel Are Caught Up on Wake
+ * @param			:	MaxMs => Longest Sleep Wanted by Caller ( Clamped to TIMEBASE_MAX_SLEEP_MS )
+ * @retval			:	void
+ * @note			:	Thread Mode With Interrupts Masked , Wake Up Handler Runs Once Caller Unmasks
+ * ======================================================================================*/
+void Timebase_Sleep(uint32_t MaxMs);
+
+#endif /* INC_TIMEBASE_H_ */
@@ -0,0 +1,50 @@
+/*
+ ******************************************************************************
+ * @file           : Timebase_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SysTick & DWT System Timebase Private Header file
+ * @Date           : Sep 1, 2023
+ ******************************************************************************
+ */
+#ifndef _TIMEBASE_PRIVATE_H_
+#define _TIMEBASE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define TIMEBASE_US_PER_MS			1000u
+
+/* SysTick Clock ( AHB ) Cycles in One Tick */
+#define TIMEBASE_CYCLES_PER_MS		(TIMEBASE_HCLK_HZ / 1000ul)
+
+/* Shortest Reload Worth Programming , SysTick Does Not Count a Reload of 0 */
+#define TIMEBASE_MIN_CYCLES			2ul
+
+/* Cycles SysTick Stands Still Every Time Timebase_Sleep Stops & Restarts it ( Disable , Read , Reprogram , Enable ) ,
+ * Taken Off The Programmed Period So Uptime Does Not Fall Behind Over Many Sleeps */
+#define TIMEBASE_STOP_CYCLES		16ul
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS PROTOTYPES SECTION                   *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Tick
+ * @brief			:	SysTick Call Back , Counts Uptime & Runs Periodic Call Back When Due
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timebase_Tick(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_LongSleep
+ * @brief			:	Sleep on One Long SysTick Period Ending on The Tick That Has Work , Then Catch Up
+ * 						Uptime & Timer Wheel With The Ticks Actually Slept
+ * @param			:	Budget => Ticks Till First Tick With Work ( At Least 2 )
+ * @param			:	Left => Cycles Left Till Next Tick , Read With SysTick Stopped
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timebase_LongSleep(uint32_t Budget, uint32_t Left);
+
+#endif /* _TIMEBASE_PRIVATE_H_ */
@@ -0,0 +1,117 @@
+/*
+ ******************************************************************************
+ * @file           : Timer_Wheel.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Hierarchical Software Timer Wheel Header File
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ */
+#ifndef INC_TIMER_WHEEL_H_
+#define INC_TIMER_WHEEL_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Longest Delay or Period Accepted ( About 24 Days ) */
+#define TIMER_WHEEL_MAX_DELAY_MS		0x7FFFFFFFul
+
+/* Call Backs Run in One Tick at Most , The Rest Run on The Next Ticks */
+#define TIMER_WHEEL_MAX_EXPIRIES_PER_TICK	8u
+
+/* Longest Idle Budget , Level 0 Must be Turned Once Per Revolution to Cascade Upper Levels */
+#define TIMER_WHEEL_MAX_IDLE_TICKS		256u
+
+/* ========================================================================= *
+ *                              TYPES SECTION                                *
+ * ========================================================================= */
+
+/* Link of a Timer in a Wheel Slot */
+typedef struct TIMER_NODE
+{
+	struct TIMER_NODE *Next;
+	struct TIMER_NODE *Prev;
+
+} TIMER_NODE_t;
+
+/* Timer Owned by Caller ( Static or Global ) , Wheel Only Links it , Zero Initialized Means Stopped */
+typedef struct
+{
+	TIMER_NODE_t Node;					/* Must Stay First */
+	uint32_t Expiry;					/* Wheel Tick of Next Expiry */
+	uint32_t PeriodMs;					/* 0 For One Shot */
+	void (*CallBack)(void *Context);	/* Called From SysTick Interrupt , Keep it Short or Post an Event */
+	void *Context;						/* Passed Back to Call Back */
+
+} TIMER_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Init
+ * @brief			:	Empty Every Wheel Slot
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Once Before Timebase Starts Ticking The Wheel
+ * ======================================================================================*/
+void TimerWheel_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Start
+ * @brief			:	Start or Restart a Timer , O(1)
+ * @param			:	Timer => Timer to Start
+ * @param			:	DelayMs => First Expiry From Now ( Max TIMER_WHEEL_MAX_DELAY_MS )
+ * @param			:	PeriodMs => Period After First Expiry , 0 For One Shot
+ * @param			:	CallBack => Expiry Call Back , Runs in SysTick Interrupt
+ * @param			:	Context => Passed Back to Call Back ( May be NULL )
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t TimerWheel_Start(TIMER_t *Timer, uint32_t DelayMs, uint32_t PeriodMs, void (*CallBack)(void *Context), void *Context);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Stop
+ * @brief			:	Stop a Timer , O(1) , Stopping a Stopped Timer Does Nothing
+ * @param			:	Timer => Timer to Stop
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t TimerWheel_Stop(TIMER_t *Timer);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_IsActive
+ * @brief			:	Check if a Timer is Waiting For its Expiry
+ * @param			:	Timer => Timer to Check
+ * @retval			:	FLAG_SET if Timer is Running , Else FLAG_RESET
+ * ======================================================================================*/
+uint8_t TimerWheel_IsActive(const TIMER_t *Timer);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Tick
+ * @brief			:	Advance Wheel One Millisecond & Run Expired Timers , At Most
+ * 						TIMER_WHEEL_MAX_EXPIRIES_PER_TICK Call Backs Per Tick
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called From Timebase SysTick Interrupt
+ * ======================================================================================*/
+void TimerWheel_Tick(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_IdleTicks
+ * @brief			:	Ticks Till The First Tick That May Have Work ( Expiry or Cascade )
+ * @param			:	void
+ * @retval			:	Ticks , At Least 1 , At Most TIMER_WHEEL_MAX_IDLE_TICKS
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+uint32_t TimerWheel_IdleTicks(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Skip
+ * @brief			:	Advance Wheel Over Ticks Slept Through Without Work
+ * @param			:	Ticks => Ticks Slept , Less Than TimerWheel_IdleTicks Before Sleep
+ * @retval			:	void
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+void TimerWheel_Skip(uint32_t Ticks);
+
+#endif /* INC_TIMER_WHEEL_H_ */
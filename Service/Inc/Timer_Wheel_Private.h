@@ -0,0 +1,98 @@
+/*
+ ******************************************************************************
+ * @file           : Timer_Wheel_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Hierarchical Software Timer Wheel Private Header file
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ */
+#ifndef _TIMER_WHEEL_PRIVATE_H_
+#define _TIMER_WHEEL_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Level 0 : 256 Slots of 1 ms , Upper Levels : 64 Slots Each 64 Times Coarser
+ *
+ *   Level 0 : Delays Up to 256 ms
+ *   Level 1 : Up to 16.3 s
+ *   Level 2 : Up to 17.4 min
+ *   Level 3 : Up to 18.6 h , Longer Delays Wait in Its Farthest Slot & Are Placed Again When Reached
+ */
+#define TIMER_WHEEL_LEVEL0_BITS		8u
+#define TIMER_WHEEL_LEVEL_BITS		6u
+#define TIMER_WHEEL_UPPER_LEVELS	3u
+
+#define TIMER_WHEEL_LEVEL0_SIZE		(1ul << TIMER_WHEEL_LEVEL0_BITS)
+#define TIMER_WHEEL_LEVEL_SIZE		(1ul << TIMER_WHEEL_LEVEL_BITS)
+#define TIMER_WHEEL_LEVEL0_MASK		(TIMER_WHEEL_LEVEL0_SIZE - 1u)
+#define TIMER_WHEEL_LEVEL_MASK		(TIMER_WHEEL_LEVEL_SIZE - 1u)
+
+/* First Bit of Level ( 1 , 2 or 3 ) Slot Index in Expiry Tick */
+#define TIMER_WHEEL_LEVEL_SHIFT(LEVEL)	(TIMER_WHEEL_LEVEL0_BITS + (((LEVEL) - 1u) * TIMER_WHEEL_LEVEL_BITS))
+
+/* Slot of Level ( 1 , 2 or 3 ) Holding an Expiry Tick */
+#define TIMER_WHEEL_LEVEL_INDEX(TICK, LEVEL)	(((TICK) >> TIMER_WHEEL_LEVEL_SHIFT(LEVEL)) & TIMER_WHEEL_LEVEL_MASK)
+
+/* Farthest Delay Level 3 Can Hold */
+#define TIMER_WHEEL_MAX_SPAN		((1ul << TIMER_WHEEL_LEVEL_SHIFT(TIMER_WHEEL_UPPER_LEVELS + 1u)) - 1u)
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS PROTOTYPES SECTION                   *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Insert
+ * @brief			:	Link a Timer in The Slot Matching its Expiry
+ * @param			:	Timer => Timer With Expiry Set
+ * @retval			:	void
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+static void TimerWheel_Insert(TIMER_t *Timer);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Cascade
+ * @brief			:	Move Every Timer of an Upper Level Slot Down to Finer Slots
+ * @param			:	Level => Upper Level ( 1 , 2 or 3 )
+ * @param			:	Index => Slot in That Level
+ * @retval			:	Slot Index , 0 Means Next Level Must Cascade Too
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+static uint32_t TimerWheel_Cascade(uint8_t Level, uint32_t Index);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListInit
+ * @brief			:	Make a List Head Point to Itself ( Empty List )
+ * @param			:	Head => List Head
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListInit(TIMER_NODE_t *Head);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListAppend
+ * @brief			:	Link a Node at The End of a List
+ * @param			:	Head => List Head
+ * @param			:	Node => Node to Link
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListAppend(TIMER_NODE_t *Head, TIMER_NODE_t *Node);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListRemove
+ * @brief			:	Unlink a Node From Whatever List Holds it
+ * @param			:	Node => Node to Unlink
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListRemove(TIMER_NODE_t *Node);
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListSplice
+ * @brief			:	Move Every Node of a List to The End of Another List , O(1)
+ * @param			:	From => List to Empty
+ * @param			:	To => List Receiving The Nodes
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListSplice(TIMER_NODE_t *From, TIMER_NODE_t *To);
+
+#endif /* _TIMER_WHEEL_PRIVATE_H_ */
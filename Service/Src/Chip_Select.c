@@ -0,0 +1,132 @@
+/*
+ ******************************************************************************
+ * @file           : Chip_Select.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software SPI Chip Select Manager Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+
+#include "../Inc/Chip_Select.h"
+#include "../Inc/Chip_Select_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Line Table Passed in ChipSelect_Init */
+static const ChipSelect_Line_t *ChipSelect_Lines = NULL;
+
+static uint8_t ChipSelect_LinesNumber = 0;
+
+/* Line Driven Low */
+static uint8_t ChipSelect_Asserted = CHIP_SELECT_NONE;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Init
+ * @brief			:	Configure NSS Lines as Outputs & Release Them All ( High )
+ * @param			:	Lines => Line Table , Index in Table is The Line Number ( Kept by Reference )
+ * @param			:	LinesNumber => Number of Lines ( Max CHIP_SELECT_MAX_LINES )
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ChipSelect_Init(const ChipSelect_Line_t *Lines, uint8_t LinesNumber)
+{
+	Error_State_t Error_State = OK;
+
+	GPIO_PinConfig_t Pin = {.Mode = OUTPUT, .OutputType = PUSH_PULL, .PullType = NO_PULL, .Speed = CHIP_SELECT_PIN_SPEED};
+
+	uint8_t Counter = 0;
+
+	if (NULL == Lines)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((0 == LinesNumber) || (LinesNumber > CHIP_SELECT_MAX_LINES))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		for (Counter = 0; (Counter < LinesNumber) && (OK == Error_State); Counter++)
+		{
+			/* Idle High Before Becoming Output So No Slave Sees a Glitch */
+			GPIO_u8SetPinValue(Lines[Counter].Port, Lines[Counter].PinNum, PIN_HIGH);
+
+			Pin.Port = Lines[Counter].Port;
+			Pin.PinNum = Lines[Counter].PinNum;
+			Error_State = GPIO_u8PinInit(&Pin);
+		}
+
+		ChipSelect_Lines = Lines;
+		ChipSelect_LinesNumber = LinesNumber;
+		ChipSelect_Asserted = CHIP_SELECT_NONE;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Assert
+ * @brief			:	Drive One NSS Line Low , Releasing The Line Asserted Before if Any
+ * @param			:	Line => Line Number
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ChipSelect_Assert(uint8_t Line)
+{
+	Error_State_t Error_State = OK;
+
+	if (Line >= ChipSelect_LinesNumber)
+	{
+		Error_State = NOK;
+	}
+	else if (Line != ChipSelect_Asserted)
+	{
+		/* Never Two Slaves Driving MISO Together */
+		ChipSelect_Release();
+
+		GPIO_u8SetPinValue(ChipSelect_Lines[Line].Port, ChipSelect_Lines[Line].PinNum, PIN_LOW);
+		ChipSelect_Asserted = Line;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_Release
+ * @brief			:	Drive Asserted NSS Line High , Ends The Transaction For That Slave
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call Only After BSY is Cleared or The Last Frame is Cut
+ * ======================================================================================*/
+void ChipSelect_Release(void)
+{
+	if (CHIP_SELECT_NONE != ChipSelect_Asserted)
+	{
+		GPIO_u8SetPinValue(ChipSelect_Lines[ChipSelect_Asserted].Port, ChipSelect_Lines[ChipSelect_Asserted].PinNum, PIN_HIGH);
+		ChipSelect_Asserted = CHIP_SELECT_NONE;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	ChipSelect_GetAsserted
+ * @brief			:	Line Currently Driven Low
+ * @param			:	void
+ * @retval			:	Line Number or CHIP_SELECT_NONE
+ * ======================================================================================*/
+uint8_t ChipSelect_GetAsserted(void)
+{
+	return ChipSelect_Asserted;
+}
@@ -0,0 +1,432 @@
+/*
+ ******************************************************************************
+ * @file           : Clock_Node.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SPI2 Slave Clock Node Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/RCC_Interface.h"
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../../Drivers/Inc/NVIC_Interface.h"
+#include "../../Drivers/Inc/EXTI_Interface.h"
+#include "../../Drivers/Inc/SYSCFG_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+#include "../../Drivers/Inc/DMA_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../Inc/Service.h"
+#include "../Inc/Panda_Link.h"
+#include "../Inc/Clock_Node.h"
+#include "../Inc/Clock_Node_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* RTC Bus & Alarm Table Owned by Service Layer */
+extern I2C_Configs_t *I2C_CONFIG;
+extern uint8_t AlarmTime[ALARMS_NUMBER][CLOCK_NODE_ALARM_FIELDS];
+
+/* SPI2 Slave Configuration , Clock Format Matches SPI1 Master , BR Bits Are Ignored in Slave Mode
+ * ( Link Rate is Whatever SPI1 Master Prescaler Clocks ) , Field Only Holds Its Reset Value */
+static SPI_CONFIGS_t ClockNode_SPIConfig =
+	{
+		.BaudRate_Value = BAUDRATE_FpclkBY2, .CRC_State = CRC_STATE_DISABLED, .CRC_Polynomial = 0, .Chip_Mode = CHIP_MODE_SLAVE, .Clock_Phase = CLOCK_PHASE_CAPTURE_FIRST, .Clock_Polarity = CLOCK_POLARITY_IDLE_LOW, .Frame_Size = DATA_FRAME_SIZE_8BITS, .Frame_Type = FRAME_FORMAT_MSB_FIRST, .MultiMaster_State = MULTIMASTER_PROVIDED, .Slave_Manage_State = SLAVE_MANAGE_HW, .SPI_Num = SPI_NUMBER2, .Transfer_Mode = TRANSFER_MODE_FULL_DUPLEX};
+
+/* DMA1 Stream3 Channel0 Drains SPI2 Rx Buffer , Frame Ends on NSS So No Interrupt is Needed */
+static DMA_INIT_STRUCT_t ClockNode_RxDmaConfig =
+	{
+		.DMAController = DMA1_CONTROLLER, .StreamNumber = DMA_STREAM3, .ChannelNumber = DMA_CHANNEL0, .PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_VERY_HIGH_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE, .Mode = DMA_NORMAL, .DoubleBuffer = DMA_DOUBLE_BUFFER_DIS, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferCompleteIT = DMA_INT_DISABLE, .TransferErrorIT = DMA_INT_DISABLE}, .FIFOMode = DMA_FIFOMODE_DISABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL};
+
+/* Stream is Fixed , Make Sure it Really Serves SPI2 Rx */
+DMA_STATIC_ASSERT_MAPPING(DMA_REQ_SPI2_RX, DMA1_CONTROLLER, DMA_STREAM3, DMA_CHANNEL0);
+
+/* Frame Being Received , Filled by SPI2 Rx DMA Stream , One Spare Byte So an Over Long Frame Shows Up in its Size */
+static uint8_t ClockNode_Frame[CLOCK_NODE_RX_BUFFER_SIZE] = {0};
+
+/* Payloads Staged by NSS Interrupt Till ClockNode_Tick Applies Them */
+static uint8_t ClockNode_Time[CLOCK_NODE_TIME_PAYLOAD_SIZE] = {0};
+static uint8_t ClockNode_Alarms[CLOCK_NODE_ALARMS_PAYLOAD_SIZE] = {0};
+
+static volatile uint8_t ClockNode_TimeFlag = FLAG_RESET;
+static volatile uint8_t ClockNode_AlarmsFlag = FLAG_RESET;
+
+/* Verdict on The Last Frame , Clocked Back at The Start of The Next Transaction */
+static uint8_t ClockNode_Verdict = PANDA_STATUS_ACK;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Init
+ * @brief			:	Configure SPI2 as Slave With Hardware NSS , DMA1 Stream3 to Drain its Rx Buffer
+ * 						& NSS Rising Edge Interrupt , Then Arm Reception of The First Frame
+ * @param			:	void
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t ClockNode_Init(void)
+{
+	Error_State_t Error_State = OK;
+
+	/* SPI2 Pins , NSS Pulled Up So a Missing Master Reads as Deselected */
+	GPIO_PinConfig_t ClockNode_Pins[CLOCK_NODE_PINS_NUMBER] =
+		{
+			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = CLOCK_NODE_NSS_PIN, .Port = PORTB, .PullType = PULL_UP, .Speed = LOW_SPEED},
+			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = CLOCK_NODE_SCK_PIN, .Port = PORTB, .PullType = NO_PULL, .Speed = HIGH_SPEED},
+			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = CLOCK_NODE_MISO_PIN, .Port = PORTB, .PullType = NO_PULL, .Speed = HIGH_SPEED},
+			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = CLOCK_NODE_MOSI_PIN, .Port = PORTB, .PullType = NO_PULL, .Speed = HIGH_SPEED}};
+
+	/* NSS Rising Edge Ends Every Frame */
+	EXTI_CONFG_t ClockNode_NSS =
+		{
+			.EXTILine = CLOCK_NODE_NSS_EXTI, .TriggerSelection = RISING_TRG, .EXTIStatus = EXTI_ENABLE, .Copy_PtrFuncEXTI = &ClockNode_FrameEnd};
+
+	RCC_APB1EnableCLK(SPI2EN);
+	RCC_APB2EnableCLK(SYSCFGEN);
+	RCC_AHB1EnableCLK(DMA1EN);
+
+	GPIO_u8PinsInit(ClockNode_Pins, CLOCK_NODE_PINS_NUMBER);
+
+	Error_State = SPI_Init(&ClockNode_SPIConfig);
+
+	/* Claim The Stream So No Other DMA User is Given it */
+	if ((OK == Error_State) && (DMA_OK != DMA_ReserveStream(DMA_REQ_SPI2_RX, &ClockNode_RxDmaConfig)))
+	{
+		Error_State = NOK;
+	}
+
+	if (OK == Error_State)
+	{
+		Error_State = DMA_Init(&ClockNode_RxDmaConfig);
+	}
+
+	if (OK == Error_State)
+	{
+		/* Let SPI2 RXNE Requests Trigger The Stream */
+		SPI_Enable_DMA_RX(SPI_NUMBER2);
+
+		/* EXTI Input Path Stays Active While The Pin is in Alternate Function Mode */
+		SYSFG_voidSetEXTIPort(CLOCK_NODE_NSS_SYSCFG_LINE, GPIO_PORTB);
+		EXTI_voidInit(&ClockNode_NSS);
+
+		/* Frame End Must Re-Arm The Stream Before Master Selects The Node Again */
+		NVIC_SetPriority(EXTI15_10_IRQ, 0);
+		NVIC_EnableIRQ(EXTI15_10_IRQ);
+
+		Error_State = ClockNode_StartFrame();
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Tick
+ * @brief			:	Apply Time & Alarm Table Received From Master ( RTC is Written Here ,
+ * 						Not in The NSS Interrupt )
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Every Second From Service Tick Event Handler Before Alarms Are Compared
+ * ======================================================================================*/
+void ClockNode_Tick(void)
+{
+	uint8_t Time[CLOCK_NODE_TIME_PAYLOAD_SIZE];
+
+	uint8_t Alarms[CLOCK_NODE_ALARMS_PAYLOAD_SIZE];
+
+	uint8_t TimeFlag = FLAG_RESET, AlarmsFlag = FLAG_RESET;
+
+	uint8_t Counter = 0;
+
+	DS1307_Config_t NodeTime;
+
+	uint32_t PrimaskState = 0;
+
+	/* Take a Consistent Copy , Next Frame May Land Any Time */
+	ENTER_CRITICAL(PrimaskState);
+
+	TimeFlag = ClockNode_TimeFlag;
+	AlarmsFlag = ClockNode_AlarmsFlag;
+	ClockNode_TimeFlag = FLAG_RESET;
+	ClockNode_AlarmsFlag = FLAG_RESET;
+
+	for (Counter = 0; Counter < CLOCK_NODE_TIME_PAYLOAD_SIZE; Counter++)
+	{
+		Time[Counter] = ClockNode_Time[Counter];
+	}
+	for (Counter = 0; Counter < CLOCK_NODE_ALARMS_PAYLOAD_SIZE; Counter++)
+	{
+		Alarms[Counter] = ClockNode_Alarms[Counter];
+	}
+
+	EXIT_CRITICAL(PrimaskState);
+
+	if (FLAG_SET == TimeFlag)
+	{
+		NodeTime.Seconds = Time[0];
+		NodeTime.Minutes = Time[1];
+		NodeTime.Hours = Time[2];
+		NodeTime.Day = (DS1307_DAYS_t)Time[3];
+		NodeTime.Month = Time[4];
+		NodeTime.Year = Time[5];
+		NodeTime.Date = Time[6];
+
+		DS1307_WriteDateTime(I2C_CONFIG, &NodeTime);
+	}
+
+	if (FLAG_SET == AlarmsFlag)
+	{
+		/* Alarm Table is Also Written by SetAlarm & Read by CompTime , All in Main Loop ( This Same Context ) */
+		for (Counter = 0; Counter < CLOCK_NODE_ALARMS_PAYLOAD_SIZE; Counter++)
+		{
+			AlarmTime[Counter / CLOCK_NODE_ALARM_FIELDS][Counter % CLOCK_NODE_ALARM_FIELDS] = Alarms[Counter];
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_SendTime
+ * @brief			:	Master Side , Queue a Time Frame For The Clock Node on SPI1
+ * @param			:	Time => Time Just Written in The RTC
+ * @retval			:	Error State ( NOK if Panda Link Queue is Full )
+ * ======================================================================================*/
+Error_State_t ClockNode_SendTime(const DS1307_Config_t *Time)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Payload[CLOCK_NODE_TIME_PAYLOAD_SIZE];
+
+	if (NULL == Time)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		Payload[0] = Time->Seconds;
+		Payload[1] = Time->Minutes;
+		Payload[2] = Time->Hours;
+		Payload[3] = (uint8_t)Time->Day;
+		Payload[4] = Time->Month;
+		Payload[5] = Time->Year;
+		Payload[6] = Time->Date;
+
+		Error_State = ClockNode_Send(CLOCK_NODE_OPCODE_TIME, Payload, CLOCK_NODE_TIME_PAYLOAD_SIZE);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_SendAlarms
+ * @brief			:	Master Side , Queue The Whole Alarm Table For The Clock Node on SPI1
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Panda Link Queue is Full )
+ * ======================================================================================*/
+Error_State_t ClockNode_SendAlarms(void)
+{
+	uint8_t Payload[CLOCK_NODE_ALARMS_PAYLOAD_SIZE];
+
+	uint8_t Counter = 0;
+
+	/* Same Row Order as ClockNode_Tick Unpacks */
+	for (Counter = 0; Counter < CLOCK_NODE_ALARMS_PAYLOAD_SIZE; Counter++)
+	{
+		Payload[Counter] = AlarmTime[Counter / CLOCK_NODE_ALARM_FIELDS][Counter % CLOCK_NODE_ALARM_FIELDS];
+	}
+
+	return ClockNode_Send(CLOCK_NODE_OPCODE_ALARMS, Payload, CLOCK_NODE_ALARMS_PAYLOAD_SIZE);
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_FrameEnd
+ * @brief			:	NSS Rising Edge Call Back , Frame Length is What Rx Stream Moved ( From NDTR ) ,
+ * 						Decodes The Frame & Arms The Next One With The Verdict as Reply
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	A Frame That Overran SPI2 Lost a Byte Somewhere , it is Dropped Without Decoding
+ * ======================================================================================*/
+static void ClockNode_FrameEnd(void)
+{
+	Error_State_t Error_State = OK;
+
+	uint16_t Remaining = CLOCK_NODE_RX_BUFFER_SIZE;
+
+	uint8_t Overrun = FLAG_RESET, Size = 0;
+
+	/* Stream is Stopped First So NDTR Can't Move While it is Read */
+	DMA_DisableStream(ClockNode_RxDmaConfig.DMAController, ClockNode_RxDmaConfig.StreamNumber);
+	DMA_GetRemaining(ClockNode_RxDmaConfig.DMAController, ClockNode_RxDmaConfig.StreamNumber, &Remaining);
+
+	if (OK != SPI_Slave_End_Frame(SPI_NUMBER2, &Overrun))
+	{
+		Overrun = FLAG_SET;
+	}
+
+	Size = (uint8_t)(CLOCK_NODE_RX_BUFFER_SIZE - Remaining);
+
+	/* Empty Transaction is a Verdict Poll , Keep The Last Verdict */
+	if ((0 != Size) || (FLAG_SET == Overrun))
+	{
+		Error_State = (FLAG_SET == Overrun) ? NOK : ClockNode_Decode(ClockNode_Frame, Size);
+
+		ClockNode_Verdict = (OK == Error_State) ? PANDA_STATUS_ACK : PANDA_STATUS_NAK;
+	}
+
+	ClockNode_StartFrame();
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_StartFrame
+ * @brief			:	Load The Verdict as Reply & Start Rx Stream on The Whole Frame Buffer
+ * @param			:	void
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_StartFrame(void)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Flags = 0;
+
+	/* Stream Flags Left From Last Frame ( Transfer Complete of an Over Long One ) Block Enabling it Again */
+	DMA_ReadInterruptFlags(ClockNode_RxDmaConfig.DMAController, ClockNode_RxDmaConfig.StreamNumber, &Flags);
+	DMA_ClearInterruptFlags(ClockNode_RxDmaConfig.DMAController, ClockNode_RxDmaConfig.StreamNumber, Flags);
+
+	Error_State = SPI_Slave_Start_Frame(SPI_NUMBER2, ClockNode_Verdict);
+
+	if ((OK == Error_State) && (DMA_OK != DMA_StartTransfer(&ClockNode_RxDmaConfig, (uint32_t *)&(SPI2->SPI_DR), (uint32_t *)ClockNode_Frame, CLOCK_NODE_RX_BUFFER_SIZE)))
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Decode
+ * @brief			:	Check a Received Frame & Stage its Payload For ClockNode_Tick
+ * @param			:	Frame => Received Bytes
+ * @param			:	Size => Number of Received Bytes
+ * @retval			:	Error State ( NOK if Frame is Malformed , Corrupted or Unknown )
+ * ======================================================================================*/
+static Error_State_t ClockNode_Decode(const uint8_t *Frame, uint8_t Size)
+{
+	Error_State_t Error_State = OK;
+
+	const uint8_t *Payload = &Frame[CLOCK_NODE_HEADER_SIZE];
+
+	uint8_t Length = 0, Counter = 0;
+
+	if (Size < (CLOCK_NODE_HEADER_SIZE + CLOCK_NODE_CRC_SIZE))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Length = Frame[1];
+
+		if ((Size != (CLOCK_NODE_HEADER_SIZE + Length + CLOCK_NODE_CRC_SIZE)) || (Frame[Size - 1] != PandaLink_CRC8(Frame, Size - CLOCK_NODE_CRC_SIZE)))
+		{
+			Error_State = NOK;
+		}
+		else if ((CLOCK_NODE_OPCODE_TIME == Frame[0]) && (CLOCK_NODE_TIME_PAYLOAD_SIZE == Length))
+		{
+			Error_State = ClockNode_CheckTime(Payload);
+
+			if (OK == Error_State)
+			{
+				for (Counter = 0; Counter < CLOCK_NODE_TIME_PAYLOAD_SIZE; Counter++)
+				{
+					ClockNode_Time[Counter] = Payload[Counter];
+				}
+				ClockNode_TimeFlag = FLAG_SET;
+			}
+		}
+		else if ((CLOCK_NODE_OPCODE_ALARMS == Frame[0]) && (CLOCK_NODE_ALARMS_PAYLOAD_SIZE == Length))
+		{
+			for (Counter = 0; Counter < CLOCK_NODE_ALARMS_PAYLOAD_SIZE; Counter++)
+			{
+				ClockNode_Alarms[Counter] = Payload[Counter];
+			}
+			ClockNode_AlarmsFlag = FLAG_SET;
+		}
+		else
+		{
+			Error_State = NOK;
+		}
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_CheckTime
+ * @brief			:	Range Check of a Time Payload
+ * @param			:	Time => Time Payload
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_CheckTime(const uint8_t *Time)
+{
+	Error_State_t Error_State = OK;
+
+	if ((Time[0] > MAX_SECONDS) || (Time[1] > MAX_MINUTES) || (Time[2] > MAX_HOURS) || (Time[3] < DS1307_SUNDAY) || (Time[3] > DS1307_SATURDAY) || (0 == Time[4]) || (Time[4] > MAX_MONTH) || (Time[5] > MAX_YEAR) || (0 == Time[6]) || (Time[6] > MAX_DATE))
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Send
+ * @brief			:	Encode a Node Frame ( CRC8 Always Appended ) & Queue it For The Clock Node
+ * @param			:	Opcode => Node Frame Opcode
+ * @param			:	Payload => Payload Bytes
+ * @param			:	Length => Number of Payload Bytes
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t ClockNode_Send(CLOCK_NODE_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length)
+{
+	uint8_t Frame[CLOCK_NODE_MAX_FRAME_SIZE];
+
+	uint8_t Counter = 0;
+
+	Frame[0] = (uint8_t)Opcode;
+	Frame[1] = Length;
+
+	for (Counter = 0; Counter < Length; Counter++)
+	{
+		Frame[CLOCK_NODE_HEADER_SIZE + Counter] = Payload[Counter];
+	}
+
+	/* Node Checks CRC8 Whatever PANDA_LINK_CRC is */
+	Frame[CLOCK_NODE_HEADER_SIZE + Length] = PandaLink_CRC8(Frame, CLOCK_NODE_HEADER_SIZE + Length);
+
+	return PandaLink_SendEncodedTo(PANDA_DEVICE_CLOCK_NODE, PANDA_PRIORITY_STATUS, Frame, CLOCK_NODE_HEADER_SIZE + Length + CLOCK_NODE_CRC_SIZE, &ClockNode_Sent);
+}
+
+/*=======================================================================================
+ * @fn		 		:	ClockNode_Sent
+ * @brief			:	Call Back of Node Frames , Verdict Comes in The Next Reply
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void ClockNode_Sent(void)
+{
+}
@@ -0,0 +1,289 @@
+/*
+ ******************************************************************************
+ * @file           : Display_Stream.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Live Clock Streaming to Panda LCD Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../Inc/Service.h"
+#include "../Inc/Panda_Link.h"
+#include "../Inc/Display_Stream.h"
+#include "../Inc/Display_Stream_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* I2C1 Configuration Set in I2C1_Init */
+extern I2C_Configs_t *I2C_CONFIG;
+
+/* Front Buffer : Last Frame Handed to Panda , Back Buffer : Next Frame */
+static uint8_t DisplayStream_Buffers[2][DISPLAY_STREAM_PAYLOAD_SIZE];
+
+/* Index of Front Buffer */
+static uint8_t DisplayStream_Front = 0;
+
+/* Back Buffer Holds a Frame Not Handed to Panda Link Yet */
+static volatile uint8_t DisplayStream_PendingFlag = FLAG_RESET;
+
+/* A Stream Frame is Queued or Being Sent */
+static volatile uint8_t DisplayStream_InFlightFlag = FLAG_RESET;
+
+/* Copy of The Last Frame Acknowledged by Panda ( Reference of Delta Frames ) */
+static uint8_t DisplayStream_Acked[DISPLAY_STREAM_PAYLOAD_SIZE];
+
+/* Next Frame Must be a Keyframe */
+static uint8_t DisplayStream_KeyframeFlag = FLAG_SET;
+
+/* Frame in Flight is a Keyframe */
+static uint8_t DisplayStream_InFlightKeyFlag = FLAG_RESET;
+
+/* Delta Frames Acknowledged Since Last Keyframe */
+static uint8_t DisplayStream_FramesSinceKey = 0;
+
+/* Stream is Running */
+static volatile uint8_t DisplayStream_RunningFlag = FLAG_RESET;
+
+/* Service Ticks Between Two Frames */
+static uint8_t DisplayStream_TicksPerFrame = DISPLAY_STREAM_TICKS_PER_SECOND;
+
+/* RTC Second Seen in Last Tick & Ticks Passed Since it Changed */
+static uint8_t DisplayStream_LastSecond = DISPLAY_STREAM_NO_SECOND;
+static uint8_t DisplayStream_Phase = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Start
+ * @brief			:	Start Pushing Current Time to Panda , Frames Are Aligned to RTC Second
+ * @param			:	Rate => Frames Per Second
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t DisplayStream_Start(DISPLAY_RATE_t Rate)
+{
+	Error_State_t Error_State = OK;
+
+	if ((0 == Rate) || (Rate > DISPLAY_STREAM_TICKS_PER_SECOND) || (0 != (DISPLAY_STREAM_TICKS_PER_SECOND % Rate)))
+	{
+		/* Frames Can't be Evenly Spread on Service Ticks */
+		Error_State = NOK;
+	}
+	else
+	{
+		DisplayStream_TicksPerFrame = DISPLAY_STREAM_TICKS_PER_SECOND / Rate;
+
+		/* First Tick Pushes a Keyframe Directly */
+		DisplayStream_LastSecond = DISPLAY_STREAM_NO_SECOND;
+		DisplayStream_KeyframeFlag = FLAG_SET;
+
+		DisplayStream_RunningFlag = FLAG_SET;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Stop
+ * @brief			:	Stop Pushing Time to Panda , Frame in Flight is Completed
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void DisplayStream_Stop(void)
+{
+	DisplayStream_RunningFlag = FLAG_RESET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Tick
+ * @brief			:	Stream Heart Beat , Pushes a Frame When it is Due
+ * @param			:	Time => RTC Time Already Read This Tick , NULL to Read it Here Only if Stream is Running
+ * @retval			:	void
+ * @note			:	Called Every SERVICE_TICK_MS From Service Tick Event Handler ( Thread Mode ,
+ * 						RTC is Read Over I2C With Interrupts Enabled )
+ * ======================================================================================*/
+void DisplayStream_Tick(const DS1307_Config_t *Time)
+{
+	uint8_t *Back = NULL;
+
+	uint32_t PrimaskState = 0;
+
+	if (FLAG_SET == DisplayStream_RunningFlag)
+	{
+		if (NULL == Time)
+		{
+			Time = DS1307_ReadDateTime(I2C_CONFIG);
+		}
+
+		/* Phase Restarts With Every RTC Second So Frames Stay Aligned to it */
+		if (Time->Seconds != DisplayStream_LastSecond)
+		{
+			DisplayStream_LastSecond = Time->Seconds;
+			DisplayStream_Phase = 0;
+		}
+		else
+		{
+			DisplayStream_Phase++;
+		}
+
+		if (0 == (DisplayStream_Phase % DisplayStream_TicksPerFrame))
+		{
+			/* DMA Completion May Push The Back Buffer */
+			ENTER_CRITICAL(PrimaskState);
+
+			/* Encode in Back Buffer , Frame in Flight is Already Copied by Panda Link */
+			Back = DisplayStream_Buffers[DisplayStream_Front ^ 1];
+			Back[0] = Time->Seconds;
+			Back[1] = Time->Minutes;
+			Back[2] = Time->Hours;
+			Back[3] = Time->Day;
+			Back[4] = Time->Month;
+			Back[5] = Time->Year;
+			Back[6] = Time->Date;
+			Back[DISPLAY_STREAM_PHASE_INDEX] = DisplayStream_Phase;
+
+			DisplayStream_PendingFlag = FLAG_SET;
+
+			/* Otherwise Back Buffer is Pushed When Frame in Flight is Done , Only Latest Frame is Kept */
+			if (FLAG_RESET == DisplayStream_InFlightFlag)
+			{
+				DisplayStream_Push();
+			}
+
+			EXIT_CRITICAL(PrimaskState);
+		}
+	}
+}
+
+/* ============================================================================*
+ * 								Private Functions							   *
+ * ============================================================================*/
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Push
+ * @brief			:	Hand Back Buffer to Panda Link & Swap Buffers
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Must be Called With Interrupts Masked or From DisplayStream_Sent
+ * ======================================================================================*/
+static void DisplayStream_Push(void)
+{
+	uint8_t Frame[DISPLAY_STREAM_PAYLOAD_SIZE + 1] = {0};
+
+	uint8_t Length = 0;
+
+	PANDA_OPCODE_t Opcode = DisplayStream_Encode(Frame, &Length);
+
+	if ((PANDA_OPCODE_DISPLAY_DELTA == Opcode) && (0 == Frame[0]))
+	{
+		/* Panda Already Shows This State */
+		DisplayStream_PendingFlag = FLAG_RESET;
+	}
+	else if (OK == PandaLink_SendFrame(Opcode, Frame, Length, DisplayStream_Sent))
+	{
+		DisplayStream_Front ^= 1;
+		DisplayStream_PendingFlag = FLAG_RESET;
+		DisplayStream_InFlightFlag = FLAG_SET;
+		DisplayStream_InFlightKeyFlag = (PANDA_OPCODE_DISPLAY == Opcode) ? FLAG_SET : FLAG_RESET;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Encode
+ * @brief			:	Build Keyframe or Delta Frame of Back Buffer Against Last Acknowledged Frame
+ * @param			:	Frame => Buffer of DISPLAY_STREAM_PAYLOAD_SIZE + 1 Bytes
+ * @param			:	Length => Number of Bytes Written in Frame
+ * @retval			:	Frame Opcode
+ * ======================================================================================*/
+static PANDA_OPCODE_t DisplayStream_Encode(uint8_t *Frame, uint8_t *Length)
+{
+	PANDA_OPCODE_t Opcode = PANDA_OPCODE_DISPLAY_DELTA;
+
+	uint8_t *Back = DisplayStream_Buffers[DisplayStream_Front ^ 1];
+
+	uint8_t Counter = 0;
+
+	if ((FLAG_SET == DisplayStream_KeyframeFlag) || (DisplayStream_FramesSinceKey >= DISPLAY_STREAM_KEYFRAME_PERIOD))
+	{
+		/* Keyframe : Whole State */
+		Opcode = PANDA_OPCODE_DISPLAY;
+		for (Counter = 0; Counter < DISPLAY_STREAM_PAYLOAD_SIZE; Counter++)
+		{
+			Frame[Counter] = Back[Counter];
+		}
+		*Length = DISPLAY_STREAM_PAYLOAD_SIZE;
+	}
+	else
+	{
+		/* Delta : Mask Then Changed Fields Only */
+		Frame[0] = 0;
+		*Length = 1;
+		for (Counter = 0; Counter < DISPLAY_STREAM_PAYLOAD_SIZE; Counter++)
+		{
+			if (Back[Counter] != DisplayStream_Acked[Counter])
+			{
+				Frame[0] |= (1 << Counter);
+				Frame[(*Length)++] = Back[Counter];
+			}
+		}
+	}
+	return Opcode;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DisplayStream_Sent
+ * @brief			:	Panda Link Call Back , Pushes The Frame Encoded Meanwhile ( If Any )
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void DisplayStream_Sent(void)
+{
+	uint8_t Counter = 0;
+
+	DisplayStream_InFlightFlag = FLAG_RESET;
+
+	if (OK == PandaLink_GetFrameState())
+	{
+		/* Panda Now Shows The Front Buffer */
+		for (Counter = 0; Counter < DISPLAY_STREAM_PAYLOAD_SIZE; Counter++)
+		{
+			DisplayStream_Acked[Counter] = DisplayStream_Buffers[DisplayStream_Front][Counter];
+		}
+
+		if (FLAG_SET == DisplayStream_InFlightKeyFlag)
+		{
+			DisplayStream_KeyframeFlag = FLAG_RESET;
+			DisplayStream_FramesSinceKey = 0;
+		}
+		else
+		{
+			DisplayStream_FramesSinceKey++;
+		}
+	}
+	else
+	{
+		/* Panda State is Unknown , Resync With a Keyframe */
+		DisplayStream_KeyframeFlag = FLAG_SET;
+	}
+
+	if (FLAG_SET == DisplayStream_PendingFlag)
+	{
+		DisplayStream_Push();
+	}
+}
@@ -0,0 +1,307 @@
+/*
+ ******************************************************************************
+ * @file           : Event_Loop.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Loop Implementation
+ * @Date           : Sep 3, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Event_Loop.h"
+#include "../Inc/Idle.h"
+#include "../Inc/Event_Loop_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static EventLoop_Slot_t EventLoop_Queue[EVENT_LOOP_QUEUE_SIZE];
+
+/* Next Position a Producer Reserves , Moved Only by Compare & Swap ( LDREX / STREX ) */
+static volatile uint32_t EventLoop_Tail = 0;
+
+/* Next Position Main Loop Takes , Only Consumer is Main Loop */
+static uint32_t EventLoop_Head = 0;
+
+static volatile uint32_t EventLoop_Dropped = 0;
+
+static EVENT_HANDLER_t EventLoop_Handlers[EVENTS_NUMBER] = {NULL};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Init
+ * @brief			:	Empty The Event Queue & Drop Every Handler
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Before Any Interrupt That Posts Events is Enabled
+ * ======================================================================================*/
+void EventLoop_Init(void)
+{
+	uint32_t Position = 0;
+	uint8_t ID = 0;
+
+	for (Position = 0; Position < EVENT_LOOP_QUEUE_SIZE; Position++)
+	{
+		EventLoop_Queue[Position].Sequence = Position;
+	}
+
+	for (ID = 0; ID < EVENTS_NUMBER; ID++)
+	{
+		EventLoop_Handlers[ID] = NULL;
+	}
+
+	EventLoop_Tail = 0;
+	EventLoop_Head = 0;
+	EventLoop_Dropped = 0;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Subscribe
+ * @brief			:	Set The Handler Dispatched For an Event , NULL Discards That Event
+ * @param			:	ID => Event
+ * @param			:	Handler => Function to Run For Every Such Event
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t EventLoop_Subscribe(EVENT_ID_t ID, EVENT_HANDLER_t Handler)
+{
+	Error_State_t Error_State = OK;
+
+	if (ID < EVENTS_NUMBER)
+	{
+		EventLoop_Handlers[ID] = Handler;
+	}
+	else
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Post
+ * @brief			:	Queue an Event Without Masking Interrupts
+ * @param			:	ID => Event
+ * @param			:	Arg => Event Byte Argument
+ * @param			:	Data => Event Half Word Argument
+ * @retval			:	Error State ( NOK if Queue is Full , Event is Dropped & Counted )
+ * @note			:	Safe From Any Interrupt Priority & From Thread Mode
+ * ======================================================================================*/
+Error_State_t EventLoop_Post(EVENT_ID_t ID, uint8_t Arg, uint16_t Data)
+{
+	Error_State_t Error_State = OK;
+
+	EventLoop_Slot_t *Slot = NULL;
+
+	uint32_t Position = 0;
+	uint32_t Sequence = 0;
+	int32_t Difference = 0;
+
+	if (ID >= EVENTS_NUMBER)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Position = __atomic_load_n(&EventLoop_Tail, __ATOMIC_RELAXED);
+
+		while (NULL == Slot)
+		{
+			Sequence = __atomic_load_n(&EventLoop_Queue[Position & EVENT_LOOP_QUEUE_MASK].Sequence, __ATOMIC_ACQUIRE);
+			Difference = (int32_t)(Sequence - Position);
+
+			if (0 == Difference)
+			{
+				/* Slot is Free , Reserve it Unless a Preempting Interrupt Reserved it First
+				 * ( Exception Entry Clears The Exclusive Monitor , So STREX Then Fails ) */
+				if (__atomic_compare_exchange_n(&EventLoop_Tail, &Position, Position + 1u, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				{
+					Slot = &EventLoop_Queue[Position & EVENT_LOOP_QUEUE_MASK];
+				}
+			}
+			else if (Difference < 0)
+			{
+				/* Main Loop Has Not Taken This Slot Yet , Queue is Full */
+				break;
+			}
+			else
+			{
+				/* Another Producer Took This Position , Retry at The New Tail */
+				Position = __atomic_load_n(&EventLoop_Tail, __ATOMIC_RELAXED);
+			}
+		}
+
+		if (NULL != Slot)
+		{
+			Slot->Event.ID = (uint8_t)ID;
+			Slot->Event.Arg = Arg;
+			Slot->Event.Data = Data;
+
+			/* Publish , Event is Visible to Main Loop Only After it is Fully Written */
+			__atomic_store_n(&Slot->Sequence, Position + 1u, __ATOMIC_RELEASE);
+		}
+		else
+		{
+			__atomic_fetch_add(&EventLoop_Dropped, 1u, __ATOMIC_RELAXED);
+			Error_State = NOK;
+		}
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Dispatch
+ * @brief			:	Run Handlers of Queued Events in Order , Each to Completion
+ * @param			:	void
+ * @retval			:	Number of Events Taken From The Queue
+ * @note			:	At Most EVENT_LOOP_QUEUE_SIZE Events Per Call , Thread Mode Only
+ * ======================================================================================*/
+uint8_t EventLoop_Dispatch(void)
+{
+	EVENT_t Event = {0};
+
+	uint8_t Count = 0;
+
+	/* Bounded So Events Posted by Handlers Themselves Cannot Keep Caller Here Forever */
+	while ((Count < EVENT_LOOP_QUEUE_SIZE) && (OK == EventLoop_Pop(&Event)))
+	{
+		EventLoop_Run(&Event);
+		Count++;
+	}
+
+	return Count;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_WaitFor
+ * @brief			:	Dispatch Every Other Event Until an Event of Given ID is Queued ,
+ * 						Core Sleeps While Queue is Empty
+ * @param			:	ID => Awaited Event
+ * @param			:	Event => Receives Awaited Event , its Handler is Not Run
+ * @retval			:	Error State
+ * @note			:	Thread Mode Only , Never From a Handler
+ * ======================================================================================*/
+Error_State_t EventLoop_WaitFor(EVENT_ID_t ID, EVENT_t *Event)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Found = FLAG_RESET;
+
+	if (NULL == Event)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (ID >= EVENTS_NUMBER)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		while (FLAG_RESET == Found)
+		{
+			if (OK == EventLoop_Pop(Event))
+			{
+				if (ID == Event->ID)
+				{
+					Found = FLAG_SET;
+				}
+				else
+				{
+					EventLoop_Run(Event);
+				}
+			}
+			else
+			{
+				Idle_Enter(IDLE_NO_LIMIT);
+			}
+		}
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_IsPending
+ * @brief			:	Check if Any Event is Queued
+ * @param			:	void
+ * @retval			:	FLAG_SET if an Event Waits For Dispatch , Else FLAG_RESET
+ * @note			:	Thread Mode , Call With Interrupts Masked to Decide Whether to Sleep
+ * ======================================================================================*/
+uint8_t EventLoop_IsPending(void)
+{
+	/* Reserved Slots Count Too , Their Producers Publish Before Thread Mode Resumes */
+	return (EventLoop_Tail != EventLoop_Head) ? FLAG_SET : FLAG_RESET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_GetDropped
+ * @brief			:	Number of Events Dropped Because Queue Was Full
+ * @param			:	void
+ * @retval			:	Dropped Events Since Init
+ * ======================================================================================*/
+uint32_t EventLoop_GetDropped(void)
+{
+	return EventLoop_Dropped;
+}
+
+/* ============================================================================*
+ * 								Private Functions							   *
+ * ============================================================================*/
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Pop
+ * @brief			:	Take Oldest Event From The Queue
+ * @param			:	Event => Receives The Event
+ * @retval			:	Error State ( NOK if No Event is Ready )
+ * ======================================================================================*/
+static Error_State_t EventLoop_Pop(EVENT_t *Event)
+{
+	Error_State_t Error_State = OK;
+
+	EventLoop_Slot_t *Slot = &EventLoop_Queue[EventLoop_Head & EVENT_LOOP_QUEUE_MASK];
+
+	/* Oldest Slot May be Reserved by an Interrupt That Was Preempted Before Publishing ,
+	 * Later Events Then Wait Behind it So Order is Kept */
+	if (__atomic_load_n(&Slot->Sequence, __ATOMIC_ACQUIRE) == (EventLoop_Head + 1u))
+	{
+		*Event = Slot->Event;
+
+		/* Hand Slot Back to Producers For Next Turn Around The Ring */
+		__atomic_store_n(&Slot->Sequence, EventLoop_Head + EVENT_LOOP_QUEUE_SIZE, __ATOMIC_RELEASE);
+
+		EventLoop_Head++;
+	}
+	else
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	EventLoop_Run
+ * @brief			:	Run Handler of an Event if Any is Subscribed
+ * @param			:	Event => Event to Handle
+ * @retval			:	void
+ * ======================================================================================*/
+static void EventLoop_Run(const EVENT_t *Event)
+{
+	if ((Event->ID < EVENTS_NUMBER) && (NULL != EventLoop_Handlers[Event->ID]))
+	{
+		EventLoop_Handlers[Event->ID](Event);
+	}
+}
@@ -0,0 +1,103 @@
+/*
+ ******************************************************************************
+ * @file           : Idle.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Tickless Idle Manager Implementation
+ * @Date           : Sep 4, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Timebase.h"
+#include "../Inc/Event_Loop.h"
+#include "../Inc/Idle.h"
+#include "../Inc/Idle_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Time Slept Since Boot , Written Only in Thread Mode */
+static uint64_t Idle_Us = 0;
+
+/* Window of Idle_GetPercent */
+static uint64_t Idle_WindowIdleUs = 0;
+static uint64_t Idle_WindowStartUs = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Idle_Enter
+ * @brief			:	Sleep Till Next Interrupt Unless an Event is Already Queued , Ticks With
+ * 						No Work Are Suppressed Meanwhile
+ * @param			:	MaxMs => Longest Sleep , IDLE_NO_LIMIT if Only Timers Bound it
+ * @retval			:	void
+ * @note			:	Thread Mode Only , Called by Main Loop When it Has Nothing to Dispatch
+ * ======================================================================================*/
+void Idle_Enter(uint32_t MaxMs)
+{
+	uint32_t PrimaskState = 0;
+
+	uint64_t SleepStartUs = 0;
+
+	/* Masked From Queue Check Till Wake , Event Posted in Between Would Otherwise Wait For Next Wake */
+	ENTER_CRITICAL(PrimaskState);
+
+	if (FLAG_RESET == EventLoop_IsPending())
+	{
+		SleepStartUs = Timebase_Micros();
+
+		Timebase_Sleep(MaxMs);
+
+		/* Uptime is Caught Up Before Wake Up Handler Runs */
+		Idle_Us += Timebase_Micros() - SleepStartUs;
+	}
+
+	EXIT_CRITICAL(PrimaskState);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Idle_GetPercent
+ * @brief			:	Share of Time Core Slept Since Previous Call ( Since Boot on First Call )
+ * @param			:	void
+ * @retval			:	Idle Percentage ( 0 - 100 ) , CPU Headroom
+ * @note			:	Thread Mode Only
+ * ======================================================================================*/
+uint8_t Idle_GetPercent(void)
+{
+	uint64_t NowUs = Timebase_Micros();
+
+	uint8_t Percent = 0;
+
+	if (NowUs > Idle_WindowStartUs)
+	{
+		Percent = (uint8_t)(((Idle_Us - Idle_WindowIdleUs) * IDLE_FULL_PERCENT) / (NowUs - Idle_WindowStartUs));
+	}
+
+	Idle_WindowIdleUs = Idle_Us;
+	Idle_WindowStartUs = NowUs;
+
+	return Percent;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Idle_GetIdleUs
+ * @brief			:	Total Time Core Slept Since Boot
+ * @param			:	void
+ * @retval			:	Idle Microseconds
+ * @note			:	Thread Mode Only
+ * ======================================================================================*/
+uint64_t Idle_GetIdleUs(void)
+{
+	return Idle_Us;
+}
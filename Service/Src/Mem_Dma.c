@@ -0,0 +1,331 @@
+/*
+ ******************************************************************************
+ * @file           : Mem_Dma.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : DMA2 Memory Copy & Fill Service Implementation
+ * @Date           : Aug 31, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/RCC_Interface.h"
+#include "../../Drivers/Inc/NVIC_Interface.h"
+#include "../../Drivers/Inc/DMA_Interface.h"
+
+#include "../Inc/Mem_Dma.h"
+#include "../Inc/Mem_Dma_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Stream , Widths & Bursts Are Filled at Init & With Every Request */
+static DMA_INIT_STRUCT_t MemDma_Config =
+	{
+		.PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_LOW_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_ENABLE, .Mode = DMA_NORMAL, .DoubleBuffer = DMA_DOUBLE_BUFFER_DIS, .Direction = DMA_MEM_TO_MEM, .EnableIT = {.TransferCompleteIT = DMA_INT_ENABLE, .TransferErrorIT = DMA_INT_ENABLE}, .FIFOMode = DMA_FIFOMODE_ENABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_FULL};
+
+static const IRQNum_t MemDma_StreamIRQ[] = MEM_DMA_STREAMS_IRQS;
+
+/* Stream Was Reserved , Otherwise Every Request is Done by CPU */
+static uint8_t MemDma_Ready = FLAG_RESET;
+
+static volatile MEM_DMA_STATE_t MemDma_State = MEM_DMA_IDLE;
+
+static void (*MemDma_CallBack)(void) = NULL;
+
+/* Source of Fill Requests , Read Without Increment */
+static uint32_t MemDma_FillWord = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Init
+ * @brief			:	Reserve a Free DMA2 Stream For Memory to Memory Transfers & Enable its Interrupt
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Every DMA2 Stream is Taken )
+ * ======================================================================================*/
+Error_State_t MemDma_Init(void)
+{
+	Error_State_t Error_State = OK;
+
+	RCC_AHB1EnableCLK(DMA2EN);
+
+	if (DMA_OK != DMA_AllocateStream(DMA_REQ_MEM_TO_MEM, &MemDma_Config))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		DMA_SetCallBack(&MemDma_Config, DMA_TRANSFER_CMP_CALLBACK, &MemDma_Complete);
+		DMA_SetCallBack(&MemDma_Config, DMA_TRANSFER_ERROR_CALLBACK, &MemDma_Error);
+
+		/* Below SPI1 Streams , Bulk Moves Can Wait For Panda Frames */
+		NVIC_SetPriority(MemDma_StreamIRQ[MemDma_Config.StreamNumber], 1);
+		NVIC_EnableIRQ(MemDma_StreamIRQ[MemDma_Config.StreamNumber]);
+
+		MemDma_Ready = FLAG_SET;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Copy
+ * @brief			:	Copy a Memory Block , Word Sized With Bursts Through FIFO When Both Ends Allow it
+ * @param			:	Destination => Where to Copy
+ * @param			:	Source => What to Copy
+ * @param			:	Size => Number of Bytes ( Max MEM_DMA_MAX_SIZE )
+ * @param			:	CallBack => Called When Copy is Done or Failed ( Check MemDma_GetState ) , May be NULL
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * @note			:	Below MEM_DMA_SYNC_THRESHOLD Copy is Done & CallBack is Called Before Return
+ * ======================================================================================*/
+Error_State_t MemDma_Copy(void *Destination, const void *Source, uint32_t Size, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t Counter = 0;
+
+	if (Destination == NULL || Source == NULL)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (Size > MEM_DMA_MAX_SIZE)
+	{
+		Error_State = NOK;
+	}
+	else if (Size < MEM_DMA_SYNC_THRESHOLD || MemDma_Ready == FLAG_RESET)
+	{
+		for (Counter = 0; Counter < Size; Counter++)
+		{
+			((uint8_t *)Destination)[Counter] = ((const uint8_t *)Source)[Counter];
+		}
+
+		if (CallBack != NULL)
+		{
+			CallBack();
+		}
+	}
+	else if (OK == MemDma_Claim())
+	{
+		Error_State = MemDma_Start(Destination, Source, Size, DMA_PINC_ENABLE, CallBack);
+	}
+	else
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Fill
+ * @brief			:	Fill a Memory Block With One Byte Value
+ * @param			:	Destination => Block to Fill
+ * @param			:	Value => Fill Byte
+ * @param			:	Size => Number of Bytes ( Max MEM_DMA_MAX_SIZE )
+ * @param			:	CallBack => Called When Fill is Done or Failed ( Check MemDma_GetState ) , May be NULL
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * @note			:	Below MEM_DMA_SYNC_THRESHOLD Fill is Done & CallBack is Called Before Return
+ * ======================================================================================*/
+Error_State_t MemDma_Fill(void *Destination, uint8_t Value, uint32_t Size, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t Counter = 0;
+
+	if (Destination == NULL)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (Size > MEM_DMA_MAX_SIZE)
+	{
+		Error_State = NOK;
+	}
+	else if (Size < MEM_DMA_SYNC_THRESHOLD || MemDma_Ready == FLAG_RESET)
+	{
+		for (Counter = 0; Counter < Size; Counter++)
+		{
+			((uint8_t *)Destination)[Counter] = Value;
+		}
+
+		if (CallBack != NULL)
+		{
+			CallBack();
+		}
+	}
+	else if (OK == MemDma_Claim())
+	{
+		/* Written Only After Claim , A Running Fill Still Reads The Old Word */
+		MemDma_FillWord = MEM_DMA_FILL_WORD(Value);
+
+		Error_State = MemDma_Start(Destination, &MemDma_FillWord, Size, DMA_PINC_DISABLE, CallBack);
+	}
+	else
+	{
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_GetState
+ * @brief			:	Report State of The Memory DMA Stream
+ * @param			:	State => Pointer to Variable to Hold The State
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t MemDma_GetState(MEM_DMA_STATE_t *State)
+{
+	Error_State_t Error_State = OK;
+
+	if (State == NULL)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		*State = MemDma_State;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Claim
+ * @brief			:	Mark The Stream Busy if it is Free
+ * @param			:	void
+ * @retval			:	Error State ( NOK if a Transfer is Already Running )
+ * ======================================================================================*/
+static Error_State_t MemDma_Claim(void)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PrimaskState = 0;
+
+	/* Requests May Come From Thread & Interrupt Context */
+	ENTER_CRITICAL(PrimaskState);
+
+	if (MemDma_State == MEM_DMA_BUSY)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		MemDma_State = MEM_DMA_BUSY;
+	}
+
+	EXIT_CRITICAL(PrimaskState);
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Start
+ * @brief			:	Shape The Claimed Stream For a Request & Start it
+ * @param			:	Destination => Where to Write
+ * @param			:	Source => Where to Read
+ * @param			:	Size => Number of Bytes
+ * @param			:	SourceInc => DMA_PINC_DISABLE For Fill , DMA_PINC_ENABLE For Copy
+ * @param			:	CallBack => Completion Call Back
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t MemDma_Start(void *Destination, const void *Source, uint32_t Size, DMA_PINC_t SourceInc, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	uint16_t Items = (uint16_t)Size;
+
+	MemDma_CallBack = CallBack;
+
+	if (MEM_DMA_IS_ALIGNED(Destination, MEM_DMA_WORD_ALIGN) && MEM_DMA_IS_ALIGNED(Source, MEM_DMA_WORD_ALIGN) && MEM_DMA_IS_ALIGNED(Size, MEM_DMA_WORD_ALIGN))
+	{
+		/* NDTR Counts Source Items */
+		Items = (uint16_t)(Size / MEM_DMA_WORD_ALIGN);
+
+		MemDma_Config.PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_32BITS;
+		MemDma_Config.MemDataWidth = DMA_MEM_DATA_WIDTH_32BITS;
+	}
+	else
+	{
+		MemDma_Config.PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS;
+		MemDma_Config.MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS;
+	}
+
+	if (MEM_DMA_IS_ALIGNED(Destination, MEM_DMA_BURST_ALIGN) && MEM_DMA_IS_ALIGNED(Size, MEM_DMA_BURST_ALIGN) &&
+		(SourceInc == DMA_PINC_DISABLE || MEM_DMA_IS_ALIGNED(Source, MEM_DMA_BURST_ALIGN)))
+	{
+		/* One Burst Empties The Full FIFO : 4 Words or 16 Bytes */
+		MemDma_Config.PeriphBurst = (MemDma_Config.PeriphDataWidth == DMA_PERIPH_DATA_WIDTH_32BITS) ? DMA_PERIPH_BURST4_TRANSFER : DMA_PERIPH_BURST16_TRANSFER;
+		MemDma_Config.MemBurst = (MemDma_Config.MemDataWidth == DMA_MEM_DATA_WIDTH_32BITS) ? DMA_MEM_BURST4_TRANSFER : DMA_MEM_BURST16_TRANSFER;
+	}
+	else
+	{
+		MemDma_Config.PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER;
+		MemDma_Config.MemBurst = DMA_MEM_SINGLE_TRANSFER;
+	}
+
+	MemDma_Config.PeriphInc = SourceInc;
+
+	DMA_Init(&MemDma_Config);
+
+	if (DMA_OK != DMA_StartTransfer(&MemDma_Config, (uint32_t *)Source, (uint32_t *)Destination, Items))
+	{
+		MemDma_CallBack = NULL;
+		MemDma_State = MEM_DMA_IDLE;
+
+		Error_State = NOK;
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Complete
+ * @brief			:	Transfer Complete Call Back , Frees The Stream & Calls User Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void MemDma_Complete(void)
+{
+	void (*CallBack)(void) = MemDma_CallBack;
+
+	/* Freed Before User Call Back , So it Can Chain The Next Request */
+	MemDma_CallBack = NULL;
+	MemDma_State = MEM_DMA_IDLE;
+
+	if (CallBack != NULL)
+	{
+		CallBack();
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	MemDma_Error
+ * @brief			:	Transfer Error Call Back , Stops The Stream & Calls User Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void MemDma_Error(void)
+{
+	void (*CallBack)(void) = MemDma_CallBack;
+
+	DMA_DisableStream(MemDma_Config.DMAController, MemDma_Config.StreamNumber);
+
+	MemDma_CallBack = NULL;
+	MemDma_State = MEM_DMA_ERROR;
+
+	if (CallBack != NULL)
+	{
+		CallBack();
+	}
+}
@@ -0,0 +1,876 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Link.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Panda Board SPI Link ( Frame Encoder ) Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../Inc/Service.h"
+#include "../Inc/Chip_Select.h"
+#include "../Inc/Event_Loop.h"
+#include "../Inc/Timebase.h"
+#include "../Inc/Panda_Link.h"
+#include "../Inc/Panda_Link_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* SPI1 Configuration Set in SPI1_Init */
+extern SPI_CONFIGS_t *SPI_CONFIG;
+
+/* Device Table : NSS Line of Every Device on SPI1 , Index is The Device Number */
+static const ChipSelect_Line_t PandaLink_Devices[PANDA_DEVICES_NUMBER] =
+	{
+		{.Port = PANDA_STATUS_NSS_PORT, .PinNum = PANDA_STATUS_NSS_PIN},
+		{.Port = PANDA_WALL_NSS_PORT, .PinNum = PANDA_WALL_NSS_PIN},
+		{.Port = PANDA_CLOCK_NODE_NSS_PORT, .PinNum = PANDA_CLOCK_NODE_NSS_PIN}};
+
+/* Frame Queues Per Device ( Last One For Broadcast Frames ) & Priority Level ,
+ * Frame in Flight Stays at Head of its Queue Till Every Target Device Got it */
+static PandaLink_Queue_t PandaLink_Queues[PANDA_LINK_QUEUES][PANDA_PRIORITY_LEVELS];
+
+/* Queue Served First Per Priority Level , Rotated So No Device Starves Others */
+static uint8_t PandaLink_NextQueue[PANDA_PRIORITY_LEVELS] = {0};
+
+/* Queue , Priority Level & Target Device of The Frame in Flight */
+static uint8_t PandaLink_InFlightQueue = 0;
+static PANDA_PRIORITY_t PandaLink_InFlightPriority = PANDA_PRIORITY_ALARM;
+static PANDA_DEVICE_t PandaLink_InFlightDevice = PANDA_DEVICE_STATUS;
+
+/* Flag Raised While a Queued Frame is in Flight */
+static volatile uint8_t PandaLink_BusyFlag = FLAG_RESET;
+
+/* Delivery State of The Frame Whose Call Back is Running */
+static Error_State_t PandaLink_LastFrameState = OK;
+
+/* Bytes Panda Clocks Back While a Frame is Sent ( Status of Previous Frame & Events ) */
+static uint8_t PandaLink_Reply[PANDA_LINK_MAX_FRAME_SIZE];
+
+/* Receiver of Panda Events */
+static void (*PandaLink_EventCallBack)(uint8_t Event) = NULL;
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+/* Copy of Last Frame Sent to Every Device , Resent if That Device Rejects it in Its Next Reply */
+static PandaLink_Prev_t PandaLink_PrevFrames[PANDA_DEVICES_NUMBER];
+#else
+/* Status Transaction Buffers , Static So DMA 32 Bit Address Registers Can Hold Them */
+static uint8_t PandaLink_StatusFill = PANDA_LINK_STATUS_FILL;
+static uint8_t PandaLink_Status = PANDA_STATUS_NAK;
+#endif
+
+/* Flag Raised When an Echo Frame is Out During Calibration */
+static volatile uint8_t PandaLink_EchoSentFlag = FLAG_RESET;
+
+/* Bit Patterns Exercising Both Levels & Every Edge */
+static const uint8_t PandaLink_CalibPattern[PANDA_LINK_CALIB_PATTERN_SIZE] = {0x55, 0xAA, 0x00, 0xFF, 0x0F, 0xF0, 0x3C, 0xC3};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Init
+ * @brief			:	Configure NSS Lines of Every Device in The Device Table
+ * @param			:	void
+ * @retval			:	Error State
+ * @note			:	Called Before Any Frame is Sent & After EventLoop_Init
+ * ======================================================================================*/
+Error_State_t PandaLink_Init(void)
+{
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+	/* Status Transaction of Every Frame is Started in Thread Mode */
+	EventLoop_Subscribe(EVENT_PANDA_STATUS, &PandaLink_StatusHandler);
+#endif
+
+	return ChipSelect_Init(PandaLink_Devices, PANDA_DEVICES_NUMBER);
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EncodeFrame
+ * @brief			:	Build a Frame ( Opcode , Length , Payload , CRC8 if Enabled )
+ * @param			:	Opcode => Frame Opcode
+ * @param			:	Payload => Payload Bytes ( May be NULL if Length is 0 )
+ * @param			:	Length => Number of Payload Bytes ( Max PANDA_LINK_MAX_PAYLOAD_SIZE )
+ * @param			:	Frame => Buffer of at Least PANDA_LINK_MAX_FRAME_SIZE Bytes
+ * @param			:	FrameSize => Number of Bytes Written in Frame
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t PandaLink_EncodeFrame(PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, uint8_t *Frame, uint8_t *FrameSize)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Counter = 0;
+
+	if ((NULL == Frame) || (NULL == FrameSize) || ((NULL == Payload) && (0 != Length)))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (Length > PANDA_LINK_MAX_PAYLOAD_SIZE)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* Header */
+		Frame[PANDA_LINK_OPCODE_INDEX] = (uint8_t)Opcode;
+		Frame[PANDA_LINK_LENGTH_INDEX] = Length;
+
+		/* Payload */
+		for (Counter = 0; Counter < Length; Counter++)
+		{
+			Frame[PANDA_LINK_HEADER_SIZE + Counter] = Payload[Counter];
+		}
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_SW
+		/* CRC8 Over Header & Payload */
+		Frame[PANDA_LINK_HEADER_SIZE + Length] = PandaLink_CRC8(Frame, PANDA_LINK_HEADER_SIZE + Length);
+#endif
+
+		*FrameSize = PANDA_LINK_HEADER_SIZE + Length + PANDA_LINK_CRC_SIZE;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendFrame
+ * @brief			:	Encode a Frame & Queue it For Every Panda Board
+ * @param			:	Opcode => Frame Opcode
+ * @param			:	Payload => Payload Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Length => Number of Payload Bytes
+ * @param			:	CallBack => Function Called When Frame is Transmitted to All Boards
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendFrame(PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, void (*CallBack)(void))
+{
+	return PandaLink_SendFrameTo(PANDA_DEVICE_BROADCAST, Opcode, Payload, Length, CallBack);
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendFrameTo
+ * @brief			:	Encode a Frame & Queue it For One Panda Board or All of Them
+ * @param			:	Device => Target Board or PANDA_DEVICE_BROADCAST
+ * @param			:	Opcode => Frame Opcode
+ * @param			:	Payload => Payload Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Length => Number of Payload Bytes
+ * @param			:	CallBack => Function Called When Frame is Transmitted to Every Target Board
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendFrameTo(PANDA_DEVICE_t Device, PANDA_OPCODE_t Opcode, const uint8_t *Payload, uint8_t Length, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	PandaLink_Queue_t *Queue = NULL;
+
+	PandaLink_Slot_t *Slot = NULL;
+
+	uint32_t PrimaskState = 0;
+
+	if (NULL == CallBack)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (Device > PANDA_DEVICE_BROADCAST)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* Broadcast Queue Follows Device Queues */
+		Queue = &PandaLink_Queues[Device][PandaLink_GetPriority(Opcode)];
+
+		/* SysTick ( Alarm ) & DMA Completion May Touch The Queues Too */
+		ENTER_CRITICAL(PrimaskState);
+
+		if (Queue->Count == PANDA_LINK_QUEUE_DEPTH)
+		{
+			/* No Free Slot in This Priority Level */
+			Error_State = NOK;
+		}
+		else
+		{
+			/* Encode Directly in The Tail Slot */
+			Slot = &Queue->Slots[(Queue->Head + Queue->Count) % PANDA_LINK_QUEUE_DEPTH];
+
+			Error_State = PandaLink_EncodeFrame(Opcode, Payload, Length, Slot->Frame, &Slot->Size);
+
+			if (OK == Error_State)
+			{
+				PandaLink_Push(Queue, Device, CallBack);
+			}
+		}
+
+		EXIT_CRITICAL(PrimaskState);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SendEncodedTo
+ * @brief			:	Queue a Frame Already Encoded by Caller ( Clock Node Frames Carry Their Own CRC8 )
+ * 						For One Device
+ * @param			:	Device => Target Device
+ * @param			:	Priority => Transmit Priority
+ * @param			:	Frame => Frame Bytes , Copied So it May be Reused Directly After Return
+ * @param			:	Size => Number of Frame Bytes ( Max PANDA_LINK_MAX_FRAME_SIZE )
+ * @param			:	CallBack => Function Called When Frame is Transmitted
+ * @retval			:	Error State ( NOK if The Priority Level Queue is Full )
+ * ======================================================================================*/
+Error_State_t PandaLink_SendEncodedTo(PANDA_DEVICE_t Device, PANDA_PRIORITY_t Priority, const uint8_t *Frame, uint8_t Size, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	PandaLink_Queue_t *Queue = NULL;
+
+	PandaLink_Slot_t *Slot = NULL;
+
+	uint8_t Counter = 0;
+
+	uint32_t PrimaskState = 0;
+
+	if ((NULL == Frame) || (NULL == CallBack))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((Device >= PANDA_DEVICES_NUMBER) || (Priority >= PANDA_PRIORITY_LEVELS) || (0 == Size) || (Size > PANDA_LINK_MAX_FRAME_SIZE))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Queue = &PandaLink_Queues[Device][Priority];
+
+		ENTER_CRITICAL(PrimaskState);
+
+		if (Queue->Count == PANDA_LINK_QUEUE_DEPTH)
+		{
+			Error_State = NOK;
+		}
+		else
+		{
+			Slot = &Queue->Slots[(Queue->Head + Queue->Count) % PANDA_LINK_QUEUE_DEPTH];
+
+			for (Counter = 0; Counter < Size; Counter++)
+			{
+				Slot->Frame[Counter] = Frame[Counter];
+			}
+			Slot->Size = Size;
+
+			PandaLink_Push(Queue, Device, CallBack);
+		}
+
+		EXIT_CRITICAL(PrimaskState);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_SetEventCallBack
+ * @brief			:	Set Function Receiving Panda Events Clocked Back in Frame Replies
+ * @param			:	CallBack => Called From DMA Completion Interrupt ( Thread Mode With PANDA_LINK_CRC_HW )
+ * 						With Every Event Byte
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t PandaLink_SetEventCallBack(void (*CallBack)(uint8_t Event))
+{
+	Error_State_t Error_State = OK;
+
+	if (NULL == CallBack)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		PandaLink_EventCallBack = CallBack;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_GetFrameState
+ * @brief			:	Delivery State of The Frame Whose Call Back is Running
+ * @param			:	void
+ * @retval			:	Error State ( NOK if Panda Never Acknowledged it , Without PANDA_LINK_CRC_HW NOK
+ * 						Means Panda Rejected The Previous Display Frame )
+ * @note			:	Valid Only Inside Frame Call Back
+ * ======================================================================================*/
+Error_State_t PandaLink_GetFrameState(void)
+{
+	return PandaLink_LastFrameState;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Calibrate
+ * @brief			:	Step SPI Prescaler Down From Fpclk/256 Toward Fpclk/2 Exchanging Echo Patterns
+ * 						With Every Panda Board , Locks in The Fastest Prescaler All of Them Pass
+ * @param			:	SPI_Config => SPI1 Configuration , BaudRate_Value is Updated With The Result
+ * @retval			:	Error State ( NOK if Panda Fails Even at Fpclk/256 , Prescaler is Left at Fpclk/256 )
+ * @note			:	Blocking , Called at Boot After Timebase , SPI1 & its DMA Are Initialized
+ * ======================================================================================*/
+Error_State_t PandaLink_Calibrate(SPI_CONFIGS_t *SPI_Config)
+{
+	Error_State_t Error_State = NOK;
+
+	SPI_BAUDRATE_VALUES_t BaudRate = BAUDRATE_FpclkBY256;
+
+	SPI_BAUDRATE_VALUES_t Fastest = BAUDRATE_FpclkBY256;
+
+	PANDA_DEVICE_t Device = PANDA_DEVICE_STATUS;
+
+	Error_State_t Passed = OK;
+
+	if (NULL == SPI_Config)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		/* Slowest First , Stop at First Failing Prescaler */
+		for (BaudRate = BAUDRATE_FpclkBY256;; BaudRate--)
+		{
+			SPI_Set_BaudRate(SPI_Config->SPI_Num, BaudRate);
+
+			/* Bus Speed is Shared , Every Board Must Follow it ( Clock Node Does Not Echo ) */
+			for (Device = PANDA_DEVICE_STATUS; (Device < PANDA_BOARDS_NUMBER) && (OK == Passed); Device++)
+			{
+				Passed = PandaLink_EchoTest(Device);
+			}
+
+			if (OK != Passed)
+			{
+				break;
+			}
+
+			Fastest = BaudRate;
+			Error_State = OK;
+
+			if (BAUDRATE_FpclkBY2 == BaudRate)
+			{
+				break;
+			}
+		}
+
+		/* Lock in The Result */
+		SPI_Config->BaudRate_Value = Fastest;
+		SPI_Set_BaudRate(SPI_Config->SPI_Num, Fastest);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_CRC8
+ * @brief			:	Calculate CRC8 ( Polynomial 0x07 ) of a Buffer
+ * @param			:	Data => Buffer
+ * @param			:	Size => Number of Bytes
+ * @retval			:	CRC8 Value
+ * ======================================================================================*/
+uint8_t PandaLink_CRC8(const uint8_t *Data, uint8_t Size)
+{
+	uint8_t CRC8 = PANDA_LINK_CRC8_INIT;
+
+	uint8_t ByteCounter = 0, BitCounter = 0;
+
+	for (ByteCounter = 0; ByteCounter < Size; ByteCounter++)
+	{
+		CRC8 ^= Data[ByteCounter];
+
+		for (BitCounter = 0; BitCounter < 8; BitCounter++)
+		{
+			if (CRC8 & 0x80)
+			{
+				CRC8 = (uint8_t)((CRC8 << 1) ^ PANDA_LINK_CRC8_POLYNOMIAL);
+			}
+			else
+			{
+				CRC8 = (uint8_t)(CRC8 << 1);
+			}
+		}
+	}
+	return CRC8;
+}
+
+/* ============================================================================*
+ * 								Private Functions							   *
+ * ============================================================================*/
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_TxDone
+ * @brief			:	SPI1 DMA Call Back , Routes Panda Events & Completes The Sent Frame , With
+ * 						PANDA_LINK_CRC_HW The Status Transaction is Started From Thread Mode
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_TxDone(void)
+{
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+	if (PANDA_DEVICE_CLOCK_NODE == PandaLink_InFlightDevice)
+	{
+		/* Node Frames Go Without SPI CRC & Status Byte , Node Drops Frames Failing Their CRC8 */
+		ChipSelect_Release();
+		PandaLink_FrameDone(PANDA_STATUS_ACK);
+	}
+	/* Ending The Transaction Waits For SPI CRC to Shift Out , Left to Thread Mode */
+	else if (OK != EventLoop_Post(EVENT_PANDA_STATUS, 0, 0))
+	{
+		/* Queue is Full So Reply Events Could Not be Posted Either ,
+		   End The Transaction & Count The Frame as Not Acknowledged */
+		ChipSelect_Release();
+		PandaLink_FrameDone(PANDA_STATUS_NAK);
+	}
+#else
+	PandaLink_RouteEvents();
+
+	/* Whole Frame is Clocked , End The Transaction */
+	ChipSelect_Release();
+
+	/* Verdict Comes in The Next Reply */
+	PandaLink_FrameDone(PANDA_STATUS_ACK);
+#endif
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_RouteEvents
+ * @brief			:	Pass Every Event Byte of The Reply to Panda Event Call Back
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Reply Buffer is Reused by The Next Frame , Called Before it is Started
+ * ======================================================================================*/
+static void PandaLink_RouteEvents(void)
+{
+	PandaLink_Queue_t *Queue = &PandaLink_Queues[PandaLink_InFlightQueue][PandaLink_InFlightPriority];
+
+	uint8_t Counter = 0;
+
+	/* Clock Node Pads its Reply After The Verdict , Only Panda Boards Send Events */
+	if (PANDA_DEVICE_CLOCK_NODE != PandaLink_InFlightDevice)
+	{
+		for (Counter = PANDA_REPLY_EVENTS_INDEX; Counter < Queue->Slots[Queue->Head].Size; Counter++)
+		{
+			if ((PANDA_EVENT_NONE != PandaLink_Reply[Counter]) && (NULL != PandaLink_EventCallBack))
+			{
+				PandaLink_EventCallBack(PandaLink_Reply[Counter]);
+			}
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_FrameDone
+ * @brief			:	Release The Sent Slot ( or Keep it For Retransmit ) , Start The Next Frame
+ * 						& Notify Frame Owner
+ * @param			:	Status => Panda Status Byte of The Sent Frame , Only Used With PANDA_LINK_CRC_HW
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_FrameDone(uint8_t Status)
+{
+	PandaLink_Queue_t *Queue = &PandaLink_Queues[PandaLink_InFlightQueue][PandaLink_InFlightPriority];
+
+	PandaLink_Slot_t *Slot = &Queue->Slots[Queue->Head];
+
+	void (*CallBack)(void) = NULL;
+
+	uint8_t Retransmit = FLAG_RESET;
+
+	Error_State_t FrameState = OK;
+
+	uint32_t PrimaskState = 0;
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+	/* Copy of The Sent Frame & Whether This Device Rejected The One it Got Before */
+	PandaLink_Prev_t *Prev = &PandaLink_PrevFrames[PandaLink_InFlightDevice];
+	PandaLink_Slot_t Sent;
+	uint8_t PrevRejected = FLAG_RESET;
+
+	(void)Status;
+#else
+	/* Frame & its Hardware CRC Are Out , Retransmit Only if Panda Did Not Acknowledge it */
+	if (PANDA_STATUS_ACK != Status)
+	{
+		if (Slot->Retries < PANDA_LINK_MAX_RETRIES)
+		{
+			Slot->Retries++;
+			Retransmit = FLAG_SET;
+		}
+		else
+		{
+			/* Frame is Dropped For This Device */
+			FrameState = NOK;
+		}
+	}
+#endif
+
+	ENTER_CRITICAL(PrimaskState);
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+	/* First Reply Byte is Device Verdict on The Previous Frame it Got , Not on The Last One on The Bus */
+	PrevRejected = ((FLAG_SET == Prev->ValidFlag) && (PANDA_STATUS_NAK == PandaLink_Reply[PANDA_REPLY_STATUS_INDEX])) ? FLAG_SET : FLAG_RESET;
+
+	if ((FLAG_SET == PrevRejected) && (PANDA_PRIORITY_DISPLAY == Prev->Priority))
+	{
+		/* Newer Display Frame is Already Out , Let Display Stream Resync Instead */
+		FrameState = NOK;
+		PrevRejected = FLAG_RESET;
+	}
+
+	/* Slot May be Reused by The Requeued Frame Below */
+	Sent = *Slot;
+#endif
+
+	if (FLAG_RESET == Retransmit)
+	{
+		/* This Device Got The Frame */
+		Slot->Devices &= ~(1 << PandaLink_InFlightDevice);
+		Slot->Retries = 0;
+		if (OK != FrameState)
+		{
+			Slot->State = NOK;
+		}
+
+		/* Release The Slot Once Every Target Device Got it */
+		if (0 == Slot->Devices)
+		{
+			CallBack = Slot->CallBack;
+			FrameState = Slot->State;
+			Queue->Head = (Queue->Head + 1) % PANDA_LINK_QUEUE_DEPTH;
+			Queue->Count--;
+		}
+	}
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+	if (FLAG_SET == PrevRejected)
+	{
+		PandaLink_Requeue(PandaLink_InFlightDevice);
+	}
+
+	/* Keep This Frame Till This Device Judges it */
+	Prev->Slot = Sent;
+	Prev->Priority = PandaLink_InFlightPriority;
+	Prev->ValidFlag = FLAG_SET;
+#endif
+
+	PandaLink_BusyFlag = FLAG_RESET;
+
+	/* Keep The Bus Busy Before Running Owner Code */
+	PandaLink_StartNext();
+
+	EXIT_CRITICAL(PrimaskState);
+
+	/* Notify Frame Owner */
+	if (NULL != CallBack)
+	{
+		PandaLink_LastFrameState = FrameState;
+		CallBack();
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StartNext
+ * @brief			:	Start DMA on The Oldest Frame of The Highest Non Empty Priority Level
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Must be Called With Interrupts Masked or From PandaLink_TxDone
+ * ======================================================================================*/
+static void PandaLink_StartNext(void)
+{
+	PANDA_PRIORITY_t Priority = PANDA_PRIORITY_ALARM;
+
+	PandaLink_Queue_t *Queue = NULL;
+
+	PandaLink_Slot_t *Slot = NULL;
+
+	uint8_t Counter = 0, QueueIndex = 0;
+
+	PANDA_DEVICE_t Device = PANDA_DEVICE_STATUS;
+
+	for (Priority = PANDA_PRIORITY_ALARM; (Priority < PANDA_PRIORITY_LEVELS) && (NULL == Slot); Priority++)
+	{
+		/* Round Robin Between Device & Broadcast Queues of The Same Level */
+		for (Counter = 0; (Counter < PANDA_LINK_QUEUES) && (NULL == Slot); Counter++)
+		{
+			QueueIndex = (PandaLink_NextQueue[Priority] + Counter) % PANDA_LINK_QUEUES;
+			Queue = &PandaLink_Queues[QueueIndex][Priority];
+
+			if (0 != Queue->Count)
+			{
+				Slot = &Queue->Slots[Queue->Head];
+			}
+		}
+	}
+
+	if (NULL != Slot)
+	{
+		Priority--;
+
+		/* Lowest Device Still Waiting For This Frame */
+		for (Device = PANDA_DEVICE_STATUS; 0 == (Slot->Devices & (1 << Device)); Device++)
+		{
+		}
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+		/* Start Every Panda Frame With a Clean CRC , Node Frames Carry Their Own CRC8 & Go Without */
+		SPI_Set_CRC_State(SPI_NUMBER1, (PANDA_DEVICE_CLOCK_NODE == Device) ? CRC_STATE_DISABLED : CRC_STATE_ENABLED);
+#endif
+
+		ChipSelect_Assert(Device);
+
+		/* Frame is in Flight Before Transfer Starts , Completion May Come Before Transmit Returns */
+		PandaLink_InFlightQueue = QueueIndex;
+		PandaLink_InFlightPriority = Priority;
+		PandaLink_InFlightDevice = Device;
+		PandaLink_BusyFlag = FLAG_SET;
+
+		if (OK == SPI1_Transmit_DMA(Slot->Frame, PandaLink_Reply, Slot->Size, PandaLink_TxDone))
+		{
+			PandaLink_NextQueue[Priority] = (QueueIndex + 1) % PANDA_LINK_QUEUES;
+		}
+		else
+		{
+			PandaLink_BusyFlag = FLAG_RESET;
+			ChipSelect_Release();
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Push
+ * @brief			:	Hand Tail Slot of a Queue ( Frame Already Written ) to Its Target Devices
+ * @param			:	Queue => Device or Broadcast Queue of One Priority Level
+ * @param			:	Device => Target Device or PANDA_DEVICE_BROADCAST
+ * @param			:	CallBack => Frame Owner Call Back
+ * @retval			:	void
+ * @note			:	Must be Called With Interrupts Masked
+ * ======================================================================================*/
+static void PandaLink_Push(PandaLink_Queue_t *Queue, PANDA_DEVICE_t Device, void (*CallBack)(void))
+{
+	PandaLink_Slot_t *Slot = &Queue->Slots[(Queue->Head + Queue->Count) % PANDA_LINK_QUEUE_DEPTH];
+
+	Slot->CallBack = CallBack;
+	Slot->Retries = 0;
+	Slot->Devices = (PANDA_DEVICE_BROADCAST == Device) ? PANDA_LINK_ALL_BOARDS : (uint8_t)(1 << Device);
+	Slot->State = OK;
+	Queue->Count++;
+
+	/* Bus is Idle , Kick The Queue */
+	if (FLAG_RESET == PandaLink_BusyFlag)
+	{
+		PandaLink_StartNext();
+	}
+}
+
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Requeue
+ * @brief			:	Put Copy of Frame Rejected by a Panda Board Back at Head of That Board Queue
+ * @param			:	Device => Board That Rejected its Previous Frame
+ * @retval			:	void
+ * @note			:	Called From PandaLink_TxDone With Interrupts Masked , Owner Was Already
+ * 						Notified So The Copy Completes Silently
+ * ======================================================================================*/
+static void PandaLink_Requeue(PANDA_DEVICE_t Device)
+{
+	PandaLink_Prev_t *Prev = &PandaLink_PrevFrames[Device];
+
+	/* Only The Device That Rejected it Gets it Again */
+	PandaLink_Queue_t *Queue = &PandaLink_Queues[Device][Prev->Priority];
+
+	if ((Queue->Count < PANDA_LINK_QUEUE_DEPTH) && (Prev->Slot.Retries < PANDA_LINK_MAX_RETRIES))
+	{
+		Queue->Head = (Queue->Head + PANDA_LINK_QUEUE_DEPTH - 1) % PANDA_LINK_QUEUE_DEPTH;
+		Queue->Slots[Queue->Head] = Prev->Slot;
+		Queue->Slots[Queue->Head].Retries++;
+		Queue->Slots[Queue->Head].Devices = (uint8_t)(1 << Device);
+		Queue->Slots[Queue->Head].State = OK;
+		Queue->Slots[Queue->Head].CallBack = PandaLink_Resent;
+		Queue->Count++;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_Resent
+ * @brief			:	Call Back of Requeued Frames
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_Resent(void)
+{
+}
+#endif
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_GetPriority
+ * @brief			:	Map Frame Opcode to its Transmit Priority
+ * @param			:	Opcode => Frame Opcode
+ * @retval			:	Priority Level
+ * ======================================================================================*/
+static PANDA_PRIORITY_t PandaLink_GetPriority(PANDA_OPCODE_t Opcode)
+{
+	PANDA_PRIORITY_t Priority = PANDA_PRIORITY_STATUS;
+
+	switch (Opcode)
+	{
+	case PANDA_OPCODE_ALARM:
+		Priority = PANDA_PRIORITY_ALARM;
+		break;
+
+	case PANDA_OPCODE_DISPLAY:
+	case PANDA_OPCODE_DISPLAY_DELTA:
+		Priority = PANDA_PRIORITY_DISPLAY;
+		break;
+
+	default:
+		/* LED Frames */
+		Priority = PANDA_PRIORITY_STATUS;
+		break;
+	}
+	return Priority;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EchoTest
+ * @brief			:	Send Test Patterns in Echo Frames & Check What Panda Clocks Back
+ * @param			:	Device => Board Under Test
+ * @retval			:	Error State ( OK if All Rounds Match )
+ * ======================================================================================*/
+static Error_State_t PandaLink_EchoTest(PANDA_DEVICE_t Device)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Pattern[PANDA_LINK_CALIB_PATTERN_SIZE] = {0};
+
+	uint16_t Echo[PANDA_LINK_CALIB_PATTERN_SIZE] = {0};
+
+	uint8_t Round = 0, Counter = 0;
+
+	uint64_t Deadline = 0;
+
+	for (Round = 0; (Round < PANDA_LINK_CALIB_ROUNDS) && (OK == Error_State); Round++)
+	{
+		/* Shift Pattern Every Round So a Stuck Echo Can't Pass */
+		for (Counter = 0; Counter < PANDA_LINK_CALIB_PATTERN_SIZE; Counter++)
+		{
+			Pattern[Counter] = PandaLink_CalibPattern[Counter] + Round;
+		}
+
+		PandaLink_EchoSentFlag = FLAG_RESET;
+
+		Error_State = PandaLink_SendFrameTo(Device, PANDA_OPCODE_ECHO, Pattern, PANDA_LINK_CALIB_PATTERN_SIZE, PandaLink_EchoSent);
+
+		/* Wait For Frame to Leave , Its Status Byte is Read by an Event Handler in PANDA_LINK_CRC_HW Mode */
+		Deadline = Timebase_Deadline(PANDA_LINK_CALIB_TIMEOUT_MS);
+		while ((OK == Error_State) && (FLAG_RESET == PandaLink_EchoSentFlag))
+		{
+			EventLoop_Dispatch();
+
+			if ((FLAG_RESET == PandaLink_EchoSentFlag) && (FLAG_SET == Timebase_IsExpired(Deadline)))
+			{
+				Error_State = TIME_OUT_ERROR;
+			}
+		}
+
+		/* Drop Bytes Received While The Frame Was Sent */
+		if (OK == Error_State)
+		{
+			SPI_Flush_RX(SPI_NUMBER1);
+		}
+
+		/* Clock Back The Whole Echo in One Streamed Transaction */
+		if (OK == Error_State)
+		{
+			ChipSelect_Assert(Device);
+			Error_State = SPI_Receive(SPI_CONFIG, Echo, PANDA_LINK_CALIB_PATTERN_SIZE);
+			ChipSelect_Release();
+		}
+
+		/* Compare */
+		for (Counter = 0; (Counter < PANDA_LINK_CALIB_PATTERN_SIZE) && (OK == Error_State); Counter++)
+		{
+			if ((uint8_t)Echo[Counter] != Pattern[Counter])
+			{
+				Error_State = NOK;
+			}
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_EchoSent
+ * @brief			:	Call Back of Echo Frames , Releases PandaLink_EchoTest
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_EchoSent(void)
+{
+	PandaLink_EchoSentFlag = FLAG_SET;
+}
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StatusHandler
+ * @brief			:	EVENT_PANDA_STATUS Handler , Routes Reply Events if Their CRC Matched , Ends
+ * 						The Frame Transaction ( Panda Checks its CRC ) & Starts The One Byte Status
+ * 						Transaction
+ * @param			:	Event => Unused
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_StatusHandler(const EVENT_t *Event)
+{
+	uint8_t CRC_Error = FLAG_RESET;
+
+	(void)Event;
+
+	/* Panda CRC Follows its Reply , CRCERR is Valid Once The Bus is Idle */
+	SPI_Flush_RX(SPI_NUMBER1);
+	SPI_Get_CRC_Error(SPI_NUMBER1, &CRC_Error);
+
+	/* Don't Act on Corrupted Events , Frame Verdict is Read Apart Below */
+	if (FLAG_RESET == CRC_Error)
+	{
+		PandaLink_RouteEvents();
+	}
+
+	/* Restart CRC For The Status Transaction , Then Release NSS So Panda Checks The Frame & Loads its Verdict */
+	SPI_Reset_CRC(SPI_NUMBER1);
+	ChipSelect_Release();
+
+	/* One Byte Transaction Carrying The Verdict , Taken by DMA Like The Frame */
+	PandaLink_Status = PANDA_STATUS_NAK;
+	ChipSelect_Assert(PandaLink_InFlightDevice);
+	if (OK != SPI1_Transmit_DMA(&PandaLink_StatusFill, &PandaLink_Status, 1, PandaLink_StatusDone))
+	{
+		ChipSelect_Release();
+		PandaLink_FrameDone(PANDA_STATUS_NAK);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaLink_StatusDone
+ * @brief			:	SPI1 DMA Call Back of The Status Transaction , Completes The Frame With
+ * 						The Status Byte Panda Clocked Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaLink_StatusDone(void)
+{
+	ChipSelect_Release();
+
+	PandaLink_FrameDone(PandaLink_Status);
+}
+#endif
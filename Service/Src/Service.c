@@ -36,20 +36,20 @@
 
 #include "../../HAL/Inc/DS1307_Interface.h"
 
+#include "../Inc/Event_Loop.h"
+#include "../Inc/Idle.h"
 #include "../Inc/Service.h"
+#include "../Inc/Panda_Link.h"
+#include "../Inc/Timebase.h"
+#include "../Inc/Timer_Wheel.h"
 #include "../Inc/Service_Private.h"
 
 /* ========================================================================= *
  *                        GLOBAL VARIABLES SECTION                           *
  * ========================================================================= */
 
-/* Variable to Send Via SPI Data in More than Case :
-   1- Number of Tries of User is Finished
-   2- System Login is Successfully Initiated
-   2- Alarm is Triggered
-   3- Display Date & Time
-*/
-uint8_t ReadingArr[30] = {0};
+/* Display Payload Sent Via SPI to Panda Board When User Chooses Display Date & Time */
+uint8_t ReadingArr[PANDA_DISPLAY_PAYLOAD_SIZE] = {0};
 
 /* Variable to Put UART Configuration in IT to Be Used in Other Functions */
 UART_Config_t *UART_CONFIG;
@@ -72,12 +72,50 @@ DS1307_Config_t *ReadingStruct;
 /* Alarm Time Array  */
 uint8_t AlarmTime[5][3] = Filling;
 
-/* Alarm Name Array */
-uint8_t AlarmName[30] = {0};
+/* Alarm Payload Array ( Alarm Number Followed by Alarm Name ) */
+uint8_t AlarmName[PANDA_LINK_MAX_PAYLOAD_SIZE] = {0};
 
-/* Counter To Store The Alarm Name Length */
+/* Counter To Store The Alarm Payload Length */
 uint8_t AlarmNameCounter = 0;
 
+/* Bit Per Alarm Raised While it Rings on Panda & Not Silenced Yet */
+static volatile uint8_t AlarmRinging = 0;
+
+/* Seconds Every Ringing Alarm Has Been Ringing */
+static uint8_t AlarmRingSeconds[ALARMS_NUMBER] = {0};
+
+/* Bit Per Alarm Whose Snooze Ended , Raised by Timer Wheel & Taken by CompTime */
+static volatile uint8_t AlarmSnoozeDue = 0;
+
+/* One Shot Timer Per Alarm Holding Its Snooze Deadline , AlarmTime Stays as Set by User */
+static TIMER_t AlarmSnooze_Timers[ALARMS_NUMBER] = {0};
+
+/* DMA2 Stream3 Channel3 Configuration Used to Feed SPI1 Tx ( SPI1_TX Request ) */
+static DMA_INIT_STRUCT_t SPI1_TX_DMA_CONFIG =
+	{
+		.DMAController = DMA2_CONTROLLER, .StreamNumber = DMA_STREAM3, .ChannelNumber = DMA_CHANNEL3, .PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_HIGH_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE, .Mode = DMA_NORMAL, .DoubleBuffer = DMA_DOUBLE_BUFFER_DIS, .Direction = DMA_MEM_TO_PERIPH, .EnableIT = {.TransferCompleteIT = DMA_INT_ENABLE, .TransferErrorIT = DMA_INT_ENABLE}, .FIFOMode = DMA_FIFOMODE_DISABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL};
+
+/* DMA2 Stream0 Channel3 Configuration Used to Drain SPI1 Rx ( SPI1_RX Request ) Into Frame Reply */
+static DMA_INIT_STRUCT_t SPI1_RX_DMA_CONFIG =
+	{
+		.DMAController = DMA2_CONTROLLER, .StreamNumber = DMA_STREAM0, .ChannelNumber = DMA_CHANNEL3, .PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_VERY_HIGH_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE, .Mode = DMA_NORMAL, .DoubleBuffer = DMA_DOUBLE_BUFFER_DIS, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferCompleteIT = DMA_INT_ENABLE, .TransferErrorIT = DMA_INT_ENABLE}, .FIFOMode = DMA_FIFOMODE_DISABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_HALF_FULL};
+
+/* Both Streams Are Fixed , Make Sure They Really Serve SPI1 */
+DMA_STATIC_ASSERT_MAPPING(DMA_REQ_SPI1_TX, DMA2_CONTROLLER, DMA_STREAM3, DMA_CHANNEL3);
+DMA_STATIC_ASSERT_MAPPING(DMA_REQ_SPI1_RX, DMA2_CONTROLLER, DMA_STREAM0, DMA_CHANNEL3);
+
+/* Flag Raised While Frame Reply is Being Received , Rx Stream Then Ends The Transfer */
+static volatile uint8_t SPI1_DMA_ReplyFlag = FLAG_RESET;
+
+/* Call Back of the Frame Currently Transmitted Through SPI1 DMA */
+static void (*SPI1_DMA_TXC_CallBack)(void) = NULL;
+
+/* Flag Raised While a Frame is Being Moved by DMA to SPI1 */
+static volatile uint8_t SPI1_DMA_BusyFlag = FLAG_RESET;
+
+/* One Shot Timer Ending The Alarm Pulse to Blue Pill Board */
+static TIMER_t AlarmPulse_Timer = {0};
+
 /* ========================================================================= *
  *                    FUNCTIONS IMPLEMENTATION SECTION                       *
  * ========================================================================= */
@@ -103,8 +141,8 @@ void WRONG_OptionChoosen(void)
 	/* Notify User to Enter a Valid Option */
 	USART_SendStringPolling(UART_CONFIG->UART_ID, "  Wrong Option , Enter Option (1-3) ");
 
-	/* delay & clear terminal */
-	DELAY_500ms();
+	/* Pause & Clear Terminal */
+	Terminal_Pause(TERMINAL_PAUSE_MS);
 
 	Clear_Terminal();
 }
@@ -136,7 +174,7 @@ void Check_IF_ContinueisNeeded(void)
 	SendNew_Line();
 
 	/* Receive User's Choice */
-	Local_ReceivedChar = UART_u16Receive(UART_CONFIG);
+	Local_ReceivedChar = Terminal_Receive();
 
 	/* Transmit the Received Data to Visualize it on Putty Terminal */
 	UART_voidTransmitData(UART_CONFIG, Local_ReceivedChar);
@@ -153,9 +191,14 @@ void Check_IF_ContinueisNeeded(void)
 		USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"-           Bye Bye :)         - \n");
 		USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"└──────────── •✧✧• ────────────┘\n");
 
-		/* Stuck in Infinite Loop */
+		/* Stuck Here , Alarms Keep Being Served & Core Sleeps in Between */
 		while (1)
-			;
+		{
+			if (0u == EventLoop_Dispatch())
+			{
+				Idle_Enter(IDLE_NO_LIMIT);
+			}
+		}
 	}
 	else
 	{
@@ -186,9 +229,6 @@ void Check_IF_ContinueisNeeded(void)
  */
 void Check_LoginInfo(uint8_t *ID_Ptr, uint8_t *Pass_Ptr, uint8_t TriesNumber)
 {
-	/* Data To Send Via SPI if Number of Tries is Finished */
-	uint8_t DATA_SENT_viaSPI[30] = {RED_LED_CODE};
-
 	/* Variable to Hold Return of Function Checking on ID & Inverted Pass */
 	ID_PASS_EQUALITY_t ID_PASS_Relation = ID_NOEQUAL_INVERTED_PASS;
 
@@ -232,7 +272,7 @@ void Check_LoginInfo(uint8_t *ID_Ptr, uint8_t *Pass_Ptr, uint8_t TriesNumber)
 	if (TriesNumber == 0)
 	{
 		/* Send A Signal To Light Up the Red LED ON BluePill Board */
-		SPI_Transmit_IT(SPI_CONFIG, DATA_SENT_viaSPI, 30, SPI_CallBackFunc);
+		PandaLink_SendFrame(PANDA_OPCODE_RED_LED, NULL, 0, SPI_CallBackFunc);
 
 		/* Execute Shutdown Sequence in SPI Call Back Function & Stuck in it */
 	}
@@ -287,7 +327,7 @@ OPTIONS_t Display_Menu(void)
 	USART_SendStringPolling(UART_CONFIG->UART_ID, "[+] select option (1-3) : ");
 
 	/* Receive Option From User */
-	ChoosenOption = (uint8_t)UART_u16Receive(UART_CONFIG);
+	ChoosenOption = (uint8_t)Terminal_Receive();
 
 	/* Display Choosen Option in Putty Terminal */
 	UART_voidTransmitData(UART_CONFIG, ChoosenOption);
@@ -356,7 +396,7 @@ uint8_t *ID_Reception(void)
 	for (Local_u8Counter = 0; Local_u8Counter < NUM_OF_ID_PASS_DIGITS; Local_u8Counter++)
 	{
 		/* Receive ID From User Digit By Digit */
-		ID[Local_u8Counter] = UART_u16Receive(UART_CONFIG);
+		ID[Local_u8Counter] = Terminal_Receive();
 
 		/* Transmit the Received Data to Visualize it on Putty */
 		UART_voidTransmitData(UART_CONFIG, ID[Local_u8Counter]);
@@ -395,14 +435,14 @@ uint8_t *Pass_Reception(void)
 	for (Local_u8Counter = 0; Local_u8Counter < NUM_OF_ID_PASS_DIGITS; Local_u8Counter++)
 	{
 		/* Receive Pass From User Digit By Digit */
-		Pass[Local_u8Counter] = UART_u16Receive(UART_CONFIG);
+		Pass[Local_u8Counter] = Terminal_Receive();
 
 		/* Transmit the * to Make the Password Invisible */
 		UART_voidTransmitData(UART_CONFIG, '*');
 	}
 
 	/* Small Delay to Visualize the Last * on Putty Terminal */
-	DELAY_500ms();
+	Terminal_Pause(TERMINAL_PAUSE_MS);
 
 	/* Send New Line to the terminal */
 	SendNew_Line();
@@ -433,6 +473,9 @@ void Clock_Init(void)
 
 	/* Enable I2C1 Clock */
 	RCC_APB1EnableCLK(I2C1EN);
+
+	/* Enable DMA2 Clock ( SPI1 Tx Stream ) */
+	RCC_AHB1EnableCLK(DMA2EN);
 }
 
 /*=======================================================================================
@@ -454,15 +497,15 @@ void Pins_Init(void)
 	/* Initializing USART2 Pins */
 	GPIO_u8PinsInit(USART2_Pins, NUM_OF_USART_PINS);
 
-	/* SPI1 GPIO Pins Configuration Working in Simplex */
+	/* SPI1 GPIO Pins Configuration Working in Full Duplex */
 	GPIO_PinConfig_t SPI1_Pins[NUM_OF_SPI_PINS] =
 		{
 			/* SPI1 MOSI Pin */
 			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = PIN7, .Port = PORTA, .PullType = NO_PULL, .Speed = LOW_SPEED},
 			/* SPI1 SCK Pin */
 			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = PIN5, .Port = PORTA, .PullType = NO_PULL, .Speed = LOW_SPEED},
-			/* SPI1 NSS Pin */
-			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = PIN4, .Port = PORTA, .PullType = PULL_UP, .Speed = LOW_SPEED}};
+			/* SPI1 MISO Pin ( Panda Replies , NSS Lines are GPIOs Owned by Panda Link ) */
+			{.AltFunc = AF5, .Mode = ALTERNATE_FUNCTION, .OutputType = PUSH_PULL, .PinNum = PIN6, .Port = PORTA, .PullType = PULL_UP, .Speed = LOW_SPEED}};
 
 	/* Initializing SPI1 Pins */
 	GPIO_u8PinsInit(SPI1_Pins, NUM_OF_SPI_PINS);
@@ -526,6 +569,9 @@ void USART2_Init(void)
 
 	/* Initialize UART Struct Globally */
 	UART_CONFIG = &USART2Config;
+
+	/* Every Received Character is Posted as an Event , Terminal Waits Run Event Loop Meanwhile */
+	UART_voidReceiveStreamIT(&USART2Config, &Terminal_Received);
 }
 
 /*==============================================================================================================================================
@@ -543,8 +589,20 @@ void Interrupts_Init(void)
 	/* Set SPI to Group Priority Zero*/
 	NVIC_SetPriority(SPI1_IRQ, 0);
 
+	/* Enable SPI1 Tx DMA Stream Interrupt & Set it to Group Priority Zero Like SPI */
+	NVIC_EnableIRQ(DMA2_Stream3_IRQ);
+	NVIC_SetPriority(DMA2_Stream3_IRQ, 0);
+
+	/* Same For SPI1 Rx DMA Stream */
+	NVIC_EnableIRQ(DMA2_Stream0_IRQ);
+	NVIC_SetPriority(DMA2_Stream0_IRQ, 0);
+
 	/* Set SYSTICK to Group Priority One*/
 	SCB_VoidSetCorePriority(SYSTICK_FAULT, (1 << 7));
+
+	/* Terminal Characters Only Post Events , Group Priority One Like SYSTICK */
+	NVIC_EnableIRQ(USART2_IRQ);
+	NVIC_SetPriority(USART2_IRQ, (1 << 3));
 }
 
 /*=======================================================================================
@@ -558,7 +616,7 @@ void SPI1_Init(void)
 	/* SPI1 Configuration */
 	static SPI_CONFIGS_t SPI1Config =
 		{
-			.BaudRate_Value = BAUDRATE_FpclkBY256, .CRC_State = CRC_STATE_DISABLED, .Chip_Mode = CHIP_MODE_MASTER, .Clock_Phase = CLOCK_PHASE_CAPTURE_FIRST, .Clock_Polarity = CLOCK_POLARITY_IDLE_LOW, .Frame_Size = DATA_FRAME_SIZE_8BITS, .Frame_Type = FRAME_FORMAT_MSB_FIRST, .MultiMaster_State = MULTIMASTER_PROVIDED, .SPI_Num = SPI_NUMBER1, .Transfer_Mode = TRANSFER_MODE_FULL_DUPLEX};
+			.BaudRate_Value = PANDA_LINK_SPI_BAUDRATE, .CRC_State = PANDA_LINK_SPI_CRC_STATE, .CRC_Polynomial = PANDA_LINK_HW_CRC_POLYNOMIAL, .Chip_Mode = CHIP_MODE_MASTER, .Clock_Phase = CLOCK_PHASE_CAPTURE_FIRST, .Clock_Polarity = CLOCK_POLARITY_IDLE_LOW, .Frame_Size = DATA_FRAME_SIZE_8BITS, .Frame_Type = FRAME_FORMAT_MSB_FIRST, .MultiMaster_State = MULTIMASTER_PROVIDED, .Slave_Manage_State = SLAVE_MANAGE_SW_SLAVE_INACTIVE, .SPI_Num = SPI_NUMBER1, .Transfer_Mode = TRANSFER_MODE_FULL_DUPLEX};
 
 	/* SPI1 Initialization */
 	SPI_Init(&SPI1Config);
@@ -567,6 +625,185 @@ void SPI1_Init(void)
 	SPI_CONFIG = &SPI1Config;
 }
 
+/*=======================================================================================
+ * @fn		 		:	SPI1_DMA_Init
+ * @brief			:	Initialize DMA2 Stream3 Channel3 to Feed SPI1 Tx Buffer & DMA2 Stream0
+ * 						Channel3 to Drain SPI1 Rx Buffer
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void SPI1_DMA_Init(void)
+{
+	/* Claim Both Streams So No Other DMA User is Given Them */
+	DMA_ReserveStream(DMA_REQ_SPI1_TX, &SPI1_TX_DMA_CONFIG);
+	DMA_ReserveStream(DMA_REQ_SPI1_RX, &SPI1_RX_DMA_CONFIG);
+
+	/* DMA2 Stream3 & Stream0 Initialization */
+	DMA_Init(&SPI1_TX_DMA_CONFIG);
+	DMA_Init(&SPI1_RX_DMA_CONFIG);
+
+	/* One Call Back Per Frame When Stream Finishes or Fails */
+	DMA_SetCallBack(&SPI1_TX_DMA_CONFIG, DMA_TRANSFER_CMP_CALLBACK, SPI1_DMA_TXC_Handler);
+	DMA_SetCallBack(&SPI1_TX_DMA_CONFIG, DMA_TRANSFER_ERROR_CALLBACK, SPI1_DMA_RXC_Handler);
+	DMA_SetCallBack(&SPI1_RX_DMA_CONFIG, DMA_TRANSFER_CMP_CALLBACK, SPI1_DMA_RXC_Handler);
+	DMA_SetCallBack(&SPI1_RX_DMA_CONFIG, DMA_TRANSFER_ERROR_CALLBACK, SPI1_DMA_RXC_Handler);
+
+	/* Let SPI1 RXNE & TXE Requests Trigger the Streams */
+	SPI_Enable_DMA_RX(SPI_NUMBER1);
+	SPI_Enable_DMA_TX(SPI_NUMBER1);
+}
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Transmit_DMA
+ * @brief			:	Transmit Buffer of data via SPI1 Using DMA & Optionally Receive What Slave
+ * 						Clocks Back Meanwhile , Call Back is Called Once When the Whole Buffer is
+ * 						Moved ( And The Reply is Received )
+ * @param			:	Frame => Buffer to Send ( Must Stay Valid Till Call Back )
+ * @param			:	Reply => Buffer of Size Bytes For Received Data , NULL to Drop it
+ * @param			:	Size => Number of Bytes to Send
+ * @param			:	CallBack => Function Called When Transfer is Done
+ * @retval			:	Error State ( NOK if a Frame is Still in Flight )
+ * ======================================================================================*/
+Error_State_t SPI1_Transmit_DMA(uint8_t *Frame, uint8_t *Reply, uint16_t Size, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	if ((NULL == Frame) || (NULL == CallBack))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (FLAG_SET == SPI1_DMA_BusyFlag)
+	{
+		/* Previous Frame Not Finished Yet */
+		Error_State = NOK;
+	}
+	else
+	{
+		SPI1_DMA_BusyFlag = FLAG_SET;
+
+		/* Set Call Back Globally */
+		SPI1_DMA_TXC_CallBack = CallBack;
+
+		/* Last Received Byte Marks The End , Rx Stream Must be Armed Before First Clock */
+		if (NULL != Reply)
+		{
+			SPI_Flush_RX(SPI_NUMBER1);
+			SPI1_DMA_ReplyFlag = FLAG_SET;
+
+			if (DMA_OK != DMA_StartTransfer(&SPI1_RX_DMA_CONFIG, (uint32_t *)&(SPI1->SPI_DR), (uint32_t *)Reply, Size))
+			{
+				SPI1_DMA_ReplyFlag = FLAG_RESET;
+				Error_State = NOK;
+			}
+		}
+
+		/* Start Moving the Frame into SPI1 Data Register */
+		if ((OK != Error_State) || (DMA_OK != DMA_StartTransfer(&SPI1_TX_DMA_CONFIG, (uint32_t *)Frame, (uint32_t *)&(SPI1->SPI_DR), Size)))
+		{
+			DMA_DisableStream(DMA2_CONTROLLER, DMA_STREAM0);
+			SPI1_DMA_ReplyFlag = FLAG_RESET;
+			SPI1_DMA_BusyFlag = FLAG_RESET;
+			Error_State = NOK;
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Calibrate
+ * @brief			:	Find The Fastest SPI1 Prescaler Panda Board Follows Reliably , Store it in
+ * 						DS1307 RAM & Report it on The Console , Stored Value is Used if Panda
+ * 						Does Not Answer
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called at Boot After SPI1 , its DMA , I2C1 & USART2 Are Initialized
+ * ======================================================================================*/
+void SPI1_Calibrate(void)
+{
+	/* Message Reported on Console , Divisor Digits Are Filled at The End */
+	char Message[] = "SPI1 Link Speed : Fpclk /    \n";
+
+	/* Magic , Prescaler , Inverted Prescaler */
+	uint8_t Record[SPI1_CALIB_RECORD_SIZE] = {0};
+
+	/* Stored Prescaler Inverted , Kept in 8 Bits to Match The Check Byte */
+	uint8_t Inverted = 0;
+
+	uint16_t Divisor = 0;
+
+	uint8_t Counter = 0;
+
+	if (OK == PandaLink_Calibrate(SPI_CONFIG))
+	{
+		/* Keep Result Across Resets */
+		Record[0] = SPI1_CALIB_MAGIC;
+		Record[1] = SPI_CONFIG->BaudRate_Value;
+		Record[2] = (uint8_t)~SPI_CONFIG->BaudRate_Value;
+		DS1307_WriteRAM(I2C_CONFIG, SPI1_CALIB_RAM_OFFSET, Record, SPI1_CALIB_RECORD_SIZE);
+	}
+	else
+	{
+		USART_SendStringPolling(UART_2, "SPI1 Link Calibration Failed\n");
+
+		/* Fall Back to Last Stored Result if it is Valid */
+		DS1307_ReadRAM(I2C_CONFIG, SPI1_CALIB_RAM_OFFSET, Record, SPI1_CALIB_RECORD_SIZE);
+		Inverted = (uint8_t)~Record[1];
+
+		if ((SPI1_CALIB_MAGIC == Record[0]) && (Inverted == Record[2]) && (Record[1] <= BAUDRATE_FpclkBY256))
+		{
+			SPI_CONFIG->BaudRate_Value = (SPI_BAUDRATE_VALUES_t)Record[1];
+			SPI_Set_BaudRate(SPI_CONFIG->SPI_Num, SPI_CONFIG->BaudRate_Value);
+		}
+	}
+
+	/* Fpclk / 2 ^ ( BR + 1 ) , Written Right Aligned in The Blank Field */
+	Divisor = 2u << SPI_CONFIG->BaudRate_Value;
+	for (Counter = sizeof(Message) - 3; Divisor != 0; Counter--)
+	{
+		Message[Counter] = (Divisor % 10) + ZERO_ASCII;
+		Divisor /= 10;
+	}
+
+	USART_SendStringPolling(UART_2, Message);
+}
+
+/*=======================================================================================
+ * @fn		 		:	SPI1_Benchmark
+ * @brief			:	Measure Polled Full Duplex SPI1 Throughput at Every Prescaler Using DWT
+ * 						Cycle Counter & Report it on The Console in Bytes Per Second
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Clocks Out Zeros , Panda Drops Them as Empty Frames , Calibrated Prescaler
+ * 						is Restored at The End
+ * ======================================================================================*/
+void SPI1_Benchmark(void)
+{
+	/* Message Reported on Console , Digits Are Filled For Every Prescaler */
+	char Message[] = "Fpclk /     :          B/s\n";
+
+	static uint16_t Block[SPI1_BENCH_BLOCK_SIZE] = {0};
+
+	SPI_BAUDRATE_VALUES_t BaudRate = BAUDRATE_FpclkBY2;
+
+	uint32_t Cycles = 0;
+
+	for (BaudRate = BAUDRATE_FpclkBY2; BaudRate <= BAUDRATE_FpclkBY256; BaudRate++)
+	{
+		SPI_Set_BaudRate(SPI_CONFIG->SPI_Num, BaudRate);
+
+		Cycles = Timebase_Cycles();
+		SPI_TransmitReceive(SPI_CONFIG, Block, NULL, SPI1_BENCH_BLOCK_SIZE);
+		Cycles = Timebase_ElapsedCycles(Cycles);
+
+		Fill_Decimal(&Message[SPI1_BENCH_DIVISOR_END], 2u << BaudRate, SPI1_BENCH_DIVISOR_DIGITS);
+		Fill_Decimal(&Message[SPI1_BENCH_RATE_END], (uint32_t)(((uint64_t)SPI1_BENCH_BLOCK_SIZE * TIMEBASE_HCLK_HZ) / Cycles), SPI1_BENCH_RATE_DIGITS);
+
+		USART_SendStringPolling(UART_2, Message);
+	}
+
+	SPI_Set_BaudRate(SPI_CONFIG->SPI_Num, SPI_CONFIG->BaudRate_Value);
+}
+
 /*=======================================================================================
  * @fn		 		:	I2C1_Init
  * @brief			:	Initialize I2C1
@@ -598,7 +835,7 @@ void I2C1_Init(void)
  *
  * @brief 			: This Function is Called Inside Call Back Function of SPI ,
  *                    When Number of Tries of User is Finished &
- *                    RED_LED_CODE is Transmitted to the Blue Pill Board ,
+ *                    Red LED Frame is Transmitted to the Blue Pill Board ,
  *                    This Function is Called to Execute the Shutdown Sequence
  *
  * @param[in]		: void
@@ -609,7 +846,7 @@ void I2C1_Init(void)
  */
 void ShutDown_Sequence(void)
 {
-	/* This Funciton is Called When Number of Tries of User is Finished & RED_LED_CODE is Transmitted to the
+	/* This Funciton is Called When Number of Tries of User is Finished & Red LED Frame is Transmitted to the
 	 * Blue Pill Board
 	 */
 	/* Clear Putty Terminal */
@@ -620,9 +857,11 @@ void ShutDown_Sequence(void)
 	USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"-     System Shut Down         - \n");
 	USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"└──────────── •✧✧• ────────────┘\n");
 
-	/* Stuck in Infinite Loop */
+	/* Stuck in Infinite Loop , Sleeping ( Called From Interrupt , Lower Priority Interrupts Cannot Wake Core ) */
 	while (1)
-		;
+	{
+		WAIT_FOR_INTERRUPT();
+	}
 }
 
 /*=======================================================================================
@@ -657,7 +896,7 @@ Error_State_t ReadDateTime_FromPC(void)
 	/*Receive the Date and Time from the user*/
 	for (uint8_t Local_Counter = 0; Local_Counter < CALENDER_FORMAT; Local_Counter++)
 	{
-		Date_Time_USART[Local_Counter] = UART_u16Receive(UART_CONFIG);
+		Date_Time_USART[Local_Counter] = Terminal_Receive();
 		UART_voidTransmitData(UART_CONFIG, Date_Time_USART[Local_Counter]);
 	}
 	/*Calculate calender Values to be send to RTC*/
@@ -681,14 +920,14 @@ Error_State_t ReadDateTime_FromPC(void)
 
 /*=======================================================================================
  * @fn		 		:	Transmit_Time
- * @brief			:	Transmit Buffer of data via SPI (with interrupt)
+ * @brief			:	Transmit Buffer of data via SPI (with DMA)
  * @param			:	void
  * @retval			:	void
  * ======================================================================================*/
 void Transmit_Time(void)
 {
-	/* Transmit Time Via SPI */
-	SPI_Transmit_IT(SPI_CONFIG, ReadingArr, 30, SPI_CALL_BACK);
+	/* Transmit Time Via SPI , Only The Display Payload is Clocked Out */
+	PandaLink_SendFrame(PANDA_OPCODE_DISPLAY, ReadingArr, PANDA_DISPLAY_PAYLOAD_SIZE, SPI_CALL_BACK);
 }
 
 /*=======================================================================================
@@ -702,16 +941,15 @@ void Reading_Time(void)
 	/* Read Date & Time */
 	ReadingStruct = DS1307_ReadDateTime(I2C_CONFIG);
 
-	/* Convert Reading Struct into Reading Array */
+	/* Convert Reading Struct into Reading Array ( Display Payload ) */
 
-	ReadingArr[0] = DISPLAY_CODE;
-	ReadingArr[1] = ReadingStruct->Seconds;
-	ReadingArr[2] = ReadingStruct->Minutes;
-	ReadingArr[3] = ReadingStruct->Hours;
-	ReadingArr[4] = ReadingStruct->Day;
-	ReadingArr[5] = ReadingStruct->Month;
-	ReadingArr[6] = ReadingStruct->Year;
-	ReadingArr[7] = ReadingStruct->Date;
+	ReadingArr[0] = ReadingStruct->Seconds;
+	ReadingArr[1] = ReadingStruct->Minutes;
+	ReadingArr[2] = ReadingStruct->Hours;
+	ReadingArr[3] = ReadingStruct->Day;
+	ReadingArr[4] = ReadingStruct->Month;
+	ReadingArr[5] = ReadingStruct->Year;
+	ReadingArr[6] = ReadingStruct->Date;
 }
 
 /*==============================================================================================================================================
@@ -730,7 +968,7 @@ void CalcAlarm(uint8_t AlarmNumber)
 	/* Receive The Alarm Time From UART And Store It In The Array */
 	for (LoopCounter = 0; LoopCounter < 8; LoopCounter++)
 	{
-		RecTemp[LoopCounter] = UART_u16Receive(UART_CONFIG);
+		RecTemp[LoopCounter] = Terminal_Receive();
 
 		UART_voidTransmitData(UART_CONFIG, RecTemp[LoopCounter]);
 	}
@@ -742,18 +980,13 @@ void CalcAlarm(uint8_t AlarmNumber)
 }
 
 /*==============================================================================================================================================
- *@fn      :  void CompTime()
+ *@fn      :  void CompTime(const DS1307_Config_t *RecievedTime)
  *@brief  :   This Function Is Responsible For Comparing The Current Time With The Alarm Time And Send The Alarm Number To The Blue Pill If They Are Equal
+ *@paramter[in]  : const DS1307_Config_t *RecievedTime : Current Time Read From The RTC by The Caller
  *@retval void :
  *==============================================================================================================================================*/
-void CompTime()
+void CompTime(const DS1307_Config_t *RecievedTime)
 {
-	/* Variable To Store The Received Time From The RTC */
-	DS1307_Config_t *RecievedTime;
-
-	/* Reading The Current Time From The RTC */
-	RecievedTime = DS1307_ReadDateTime(I2C_CONFIG);
-
 	/* Array To Store The Current Time From The Current Time Recieved From The RTC */
 	uint8_t CurrentTime[3] = {
 		RecievedTime->Hours, RecievedTime->Minutes, RecievedTime->Seconds};
@@ -764,8 +997,19 @@ void CompTime()
 	/* Variable To Check The Equality Between The Current Time And The Alarm Time */
 	Equality_t EqualityCheck = NotEqual;
 
+	/* Alarms Whose Snooze Ended Since Last Second */
+	uint8_t SnoozeDue = 0;
+
+	uint32_t PrimaskState = 0;
+
+	/* Timer Wheel Raises Bits From SysTick */
+	ENTER_CRITICAL(PrimaskState);
+	SnoozeDue = AlarmSnoozeDue;
+	AlarmSnoozeDue = 0;
+	EXIT_CRITICAL(PrimaskState);
+
 	/* Loop On The Alarm Number */
-	for (Counter1 = 0; Counter1 < 5; Counter1++)
+	for (Counter1 = 0; Counter1 < ALARMS_NUMBER; Counter1++)
 	{
 		/* Check If The Alarm Time Is Not Empty */
 		if (AlarmTime[Counter1][0] != 0xFF)
@@ -793,15 +1037,84 @@ void CompTime()
 		{
 			continue;
 		}
-		/* If The Current Time Is Equal To The Alarm Time Send The Alarm Number To The Blue Pill */
-		if (EqualityCheck == Equal)
+		/* If The Current Time Is Equal To The Alarm Time ( or Its Snooze Ended ) Send The Alarm Number To The Blue Pill */
+		if ((EqualityCheck == Equal) || (SnoozeDue & (1 << Counter1)))
+		{
+			/* Keep Ringing Till User Silences it on Panda ( Panda Events Are Handled in This Same Context ) */
+			AlarmRinging |= (1 << Counter1);
+			AlarmRingSeconds[Counter1] = 0;
+
+			/* Alarm Frame is Sent by Its Own Event , Time Check Stays Short */
+			EventLoop_Post(EVENT_ALARM_MATCH, Counter1, 0);
+		}
+		/* Alarm Not Acknowledged Yet , Remind Panda Periodically */
+		else if (AlarmRinging & (1 << Counter1))
+		{
+			AlarmRingSeconds[Counter1]++;
+
+			if (AlarmRingSeconds[Counter1] >= (ALARM_REPEAT_SECONDS * ALARM_MAX_REPEATS))
+			{
+				/* Nobody Around , Give Up */
+				AlarmRinging &= ~(1 << Counter1);
+			}
+			else if (0 == (AlarmRingSeconds[Counter1] % ALARM_REPEAT_SECONDS))
+			{
+				EventLoop_Post(EVENT_ALARM_MATCH, Counter1, 0);
+			}
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      :  void AlarmEvent(uint8_t Event)
+ *@brief  :   Panda Event Call Back , Silences Ringing Alarms When User Acknowledges Them or Presses Silence Button ,
+ *            Snooze Button Rings Them Again ALARM_SNOOZE_MINUTES Later Without Touching AlarmTime
+ *@paramter[in]  : uint8_t Event : Event Byte Clocked Back by Panda
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmEvent(uint8_t Event)
+{
+	uint8_t Argument = Event & PANDA_EVENT_ARG_MASK;
+
+	uint8_t Counter = 0;
+
+	switch (Event & PANDA_EVENT_TYPE_MASK)
+	{
+	case PANDA_EVENT_ALARM_ACK:
+		if ((Argument >= 1) && (Argument <= ALARMS_NUMBER))
+		{
+			AlarmRinging &= ~(1 << (Argument - 1));
+		}
+		break;
+
+	case PANDA_EVENT_BUTTON:
+		if (PANDA_BUTTON_SNOOZE == Argument)
+		{
+			for (Counter = 0; Counter < ALARMS_NUMBER; Counter++)
+			{
+				if (AlarmRinging & (1 << Counter))
+				{
+					/* Daily Alarm Time is Kept , Snooze Deadline Lives on The Timer Wheel */
+					TimerWheel_Start(&AlarmSnooze_Timers[Counter], ALARM_SNOOZE_MS, 0, &AlarmSnooze_End, (void *)(uintptr_t)Counter);
+				}
+			}
+			AlarmRinging = 0;
+		}
+		else if (PANDA_BUTTON_SILENCE == Argument)
 		{
-			AlarmName[0] = ALARMCODE;
-			/* Variable To Store The Alarm Number */
-			AlarmName[1] = ++Counter1;
-			/* Send The Alarm Number To The Blue Pill */
-			SPI_Transmit_IT(SPI_CONFIG, AlarmName, 30, &SPI1_ISR);
+			/* Silence Also Drops Pending Snoozes */
+			for (Counter = 0; Counter < ALARMS_NUMBER; Counter++)
+			{
+				AlarmSnooze_Cancel(Counter);
+			}
+
+			AlarmRinging = 0;
 		}
+		break;
+
+	default:
+		/* Not an Alarm Event */
+		break;
 	}
 }
 
@@ -811,11 +1124,38 @@ void CompTime()
  *@retval void :
  *==============================================================================================================================================*/
 void SPI1_ISR()
+{
+	/* Pulse is Started by Main Loop */
+	EventLoop_Post(EVENT_SPI_DONE, 0, 0);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmSend(uint8_t AlarmIndex)
+ *@brief  :  Sends The Alarm Number & Name To Panda , SPI1_ISR is Called Once The Frame is Out
+ *@paramter[in]  : uint8_t AlarmIndex : Index Of The Ringing Alarm
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmSend(uint8_t AlarmIndex)
+{
+	/* Variable To Store The Alarm Number */
+	AlarmName[0] = AlarmIndex + 1;
+
+	/* Send The Alarm Number & Name To The Blue Pill */
+	PandaLink_SendFrame(PANDA_OPCODE_ALARM, AlarmName, AlarmNameCounter, &SPI1_ISR);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmPulse_Start()
+ *@brief  :  Starts The Alarm Pulse to Blue Pill Board , AlarmPulse_End Ends it After ALARM_PULSE_MS
+ *@retval void :
+ *==============================================================================================================================================*/
+void AlarmPulse_Start(void)
 {
 	/* Notify The Blue Pill That The Alarm Is Fired */
 	GPIO_u8SetPinValue(PORTB, PIN6, PIN_HIGH);
-	DELAY_500ms();
-	GPIO_u8SetPinValue(PORTB, PIN6, PIN_LOW);
+
+	/* Restarted if Already Running , Pulse Then Lasts From The Latest Alarm */
+	TimerWheel_Start(&AlarmPulse_Timer, ALARM_PULSE_MS, 0, &AlarmPulse_End, NULL);
 }
 
 /*==============================================================================================================================================
@@ -828,13 +1168,16 @@ void SetAlarm()
 	/* Variable To Store The Alarm Number */
 	uint8_t ChooseNum = 0;
 
+	/* For Loop Counter */
+	uint8_t Local_u8Counter = 0;
+
 	SendNew_Line();
 
 	/* Ask The User To Choose The Alarm Number */
 	USART_SendStringPolling(UART_2, "Please Choose Alarm Number From ( 1 ~ 5 )\nYour Choice: ");
 
 	/* Receive The Alarm Number From The User */
-	ChooseNum = UART_u16Receive(UART_CONFIG);
+	ChooseNum = Terminal_Receive();
 
 	/* To Print on Terminal What User Typed */
 	UART_voidTransmitData(UART_CONFIG, ChooseNum);
@@ -844,12 +1187,18 @@ void SetAlarm()
 	/* Ask The User To Enter The Alarm Name */
 	USART_SendStringPolling(UART_2, "Please Enter Alarm Name: ");
 
+	/* Drop Previous Name , Byte 0 Holds The Alarm Number */
+	for (Local_u8Counter = 1; Local_u8Counter < PANDA_LINK_MAX_PAYLOAD_SIZE; Local_u8Counter++)
+	{
+		AlarmName[Local_u8Counter] = 0;
+	}
+
 	/* Loop To Receive The Alarm Name From The User Until The User Press Enter */
-	for (AlarmNameCounter = 2; AlarmNameCounter < 30; AlarmNameCounter++)
+	for (AlarmNameCounter = 1; AlarmNameCounter < PANDA_LINK_MAX_PAYLOAD_SIZE; AlarmNameCounter++)
 	{
 
 		/* Receive The Alarm Name From The User */
-		AlarmName[AlarmNameCounter] = UART_u16Receive(UART_CONFIG);
+		AlarmName[AlarmNameCounter] = Terminal_Receive();
 		if (AlarmName[AlarmNameCounter] == 13)
 		{
 			break;
@@ -863,6 +1212,10 @@ void SetAlarm()
 	if (ChooseNum > '0' && ChooseNum < '6')
 	{
 		USART_SendStringPolling(UART_2, "Please Enter Your Alarm in this sequence xx:xx:xx\n");
+
+		/* Snooze of The Old Alarm Must Not Ring The New One */
+		AlarmSnooze_Cancel(ChooseNum - '1');
+
 		CalcAlarm(ChooseNum - 1);
 	}
 	/* If The Alarm Number Is Not In The Range Send Wrong Choice To The User */
@@ -882,8 +1235,7 @@ void SetAlarm()
  *==============================================================================================================================================*/
 void SendGreenSignal( void )
 {
-	ReadingArr[0] = GREEN_LED_CODE ;
-	SPI_Transmit_IT(SPI_CONFIG, ReadingArr , 30 , SPI_CALL_BACK) ;
+	PandaLink_SendFrame(PANDA_OPCODE_GREEN_LED, NULL, 0, SPI_CALL_BACK) ;
 }
 
 /* ============================================================================*
@@ -947,6 +1299,116 @@ static DS1307_DAYS_t FindDay(uint8_t *Calender)
 	return Day;
 }
 
+/*=======================================================================================
+ * @fn		 		:	Terminal_Receive
+ * @brief			:	Wait For a Character From Terminal , Queued Events Are Handled Meanwhile
+ * @param			:	void
+ * @retval			:	Received Character
+ * ======================================================================================*/
+static uint16_t Terminal_Receive(void)
+{
+	EVENT_t Event = {0};
+
+	EventLoop_WaitFor(EVENT_UART_RX, &Event);
+
+	return Event.Data;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Terminal_Pause
+ * @brief			:	Pause Terminal Output , Queued Events Are Handled Meanwhile
+ * @param			:	PauseMs => Pause in Milliseconds
+ * @retval			:	void
+ * ======================================================================================*/
+static void Terminal_Pause(uint32_t PauseMs)
+{
+	uint64_t Deadline = Timebase_Deadline(PauseMs);
+	uint64_t NowMs = Timebase_Millis();
+
+	while (NowMs < Deadline)
+	{
+		if (0u == EventLoop_Dispatch())
+		{
+			/* Pause End is Not a Timer , Sleep Must Not Run Past it */
+			Idle_Enter((uint32_t)(Deadline - NowMs));
+		}
+
+		NowMs = Timebase_Millis();
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Terminal_Received
+ * @brief			:	USART2 Receive Call Back , Posts The Character
+ * @param			:	Data => Received Character
+ * @retval			:	void
+ * ======================================================================================*/
+static void Terminal_Received(uint16_t Data)
+{
+	EventLoop_Post(EVENT_UART_RX, 0, Data);
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPulse_End
+ * @brief			:	Alarm Pulse Timer Call Back , Ends The Pulse to Blue Pill Board
+ * @param			:	Context => Unused
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmPulse_End(void *Context)
+{
+	(void)Context;
+
+	GPIO_u8SetPinValue(PORTB, PIN6, PIN_LOW);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmSnooze_End(void *Context)
+ *@brief  :  Snooze Timer Call Back ( SysTick Context ) , Hands The Alarm Back to CompTime Which Rings it Again
+ *@paramter[in]  : void *Context : Alarm Index
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmSnooze_End(void *Context)
+{
+	AlarmSnoozeDue |= (uint8_t)(1u << (uint8_t)(uintptr_t)Context);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmSnooze_Cancel(uint8_t AlarmIndex)
+ *@brief  :  Drops a Pending Snooze of an Alarm , Whether Still Counting or Already Due
+ *@paramter[in]  : uint8_t AlarmIndex : Index Of The Alarm
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmSnooze_Cancel(uint8_t AlarmIndex)
+{
+	uint32_t PrimaskState = 0;
+
+	TimerWheel_Stop(&AlarmSnooze_Timers[AlarmIndex]);
+
+	/* Timer Wheel Raises Bits From SysTick */
+	ENTER_CRITICAL(PrimaskState);
+	AlarmSnoozeDue &= (uint8_t)~(1u << AlarmIndex);
+	EXIT_CRITICAL(PrimaskState);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Fill_Decimal
+ * @brief			:	Write Number Right Aligned in a Blank Message Field
+ * @param			:	Field_End => Last Character of The Field
+ * @param			:	Value => Number to Write
+ * @param			:	Width => Field Width , Higher Digits Are Dropped
+ * @retval			:	void
+ * ======================================================================================*/
+static void Fill_Decimal(char *Field_End, uint32_t Value, uint8_t Width)
+{
+	uint8_t Counter = 0;
+
+	for (Counter = 0; Counter < Width; Counter++)
+	{
+		*(Field_End - Counter) = ((0 == Counter) || (0 != Value)) ? (char)((Value % 10) + ZERO_ASCII) : ' ';
+		Value /= 10;
+	}
+}
+
 /*=======================================================================================
  * @fn		 		:	Calculate_Calender
  * @brief			:	Translate The Calender given by the user from ASCII to Decimal values
@@ -1099,3 +1561,46 @@ static uint8_t *InvertPass(uint8_t *Arr, uint8_t ArrSize)
 void SPI_CALL_BACK(void)
 {
 }
+
+/* DMA2 Stream3 Call Back , Frame is Completely Moved to SPI1 ( or Stream Failed ) */
+void SPI1_DMA_TXC_Handler(void)
+{
+	/* Reply Still Coming ( Rx Stream Ends The Transfer ) or Transfer Already Ended by Rx Stream */
+	if ((FLAG_SET == SPI1_DMA_ReplyFlag) || (FLAG_RESET == SPI1_DMA_BusyFlag))
+	{
+		return;
+	}
+
+	/* Stream is Free For the Next Frame */
+	SPI1_DMA_BusyFlag = FLAG_RESET;
+
+	/* Notify Frame Owner */
+	if (NULL != SPI1_DMA_TXC_CallBack)
+	{
+		SPI1_DMA_TXC_CallBack();
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      :  void SPI1_DMA_RXC_Handler()
+ *@brief   :  DMA2 Stream0 Call Back ( & Error Call Back of Both Streams ) , Called Once the Whole Reply is Received ,
+ *            Ends The Transfer & Calls the Call Back of the Frame Owner
+ *@retval  :  void
+ *==============================================================================================================================================*/
+void SPI1_DMA_RXC_Handler(void)
+{
+	/* Stop Both Streams in Case This is an Error */
+	DMA_DisableStream(DMA2_CONTROLLER, DMA_STREAM0);
+	DMA_DisableStream(DMA2_CONTROLLER, DMA_STREAM3);
+
+	SPI1_DMA_ReplyFlag = FLAG_RESET;
+
+	/* Stream is Free For the Next Frame */
+	SPI1_DMA_BusyFlag = FLAG_RESET;
+
+	/* Notify Frame Owner */
+	if (NULL != SPI1_DMA_TXC_CallBack)
+	{
+		SPI1_DMA_TXC_CallBack();
+	}
+}
@@ -0,0 +1,390 @@
+/*
+ ******************************************************************************
+ * @file           : Timebase.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : SysTick & DWT System Timebase Implementation
+ * @Date           : Sep 1, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/SYSTICK_Interface.h"
+
+#include "../Inc/Timebase.h"
+#include "../Inc/Timer_Wheel.h"
+#include "../Inc/Timebase_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Uptime , Written Only by Tick Interrupt */
+static volatile uint64_t Timebase_Ms = 0;
+
+/* Periodic Work Driven From Tick Interrupt */
+static void (*volatile Timebase_CallBack)(void) = NULL;
+static volatile uint32_t Timebase_PeriodMs = 0;
+static uint32_t Timebase_PeriodCounter = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Init
+ * @brief			:	Start SysTick at 1 kHz From AHB & DWT Cycle Counter , Uptime Starts at 0
+ * @param			:	void
+ * @retval			:	Error State
+ * @note			:	SysTick Belongs to Timebase From Now on , Periodic Work Goes Through Timebase_SetPeriodicCallBack
+ * ======================================================================================*/
+Error_State_t Timebase_Init(void)
+{
+	Error_State_t Error_State = OK;
+
+	/* Free Running Cycle Counter , Never Reset So Every Module Can Take Timestamps */
+	COREDEBUG->DEMCR |= (1UL << DEMCR_TRCENA);
+	DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+	Timebase_Ms = 0;
+
+	Error_State = SYSTICK_voidSetINT(TIMEBASE_TICK_MS, SYSTICK_CLOCK_AHB_DIRECT, &Timebase_Tick);
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_SetPeriodicCallBack
+ * @brief			:	Call a Function From SysTick Interrupt Every Period
+ * @param			:	PeriodMs => Call Period in Milliseconds ( Not 0 )
+ * @param			:	CallBack => Function to Call
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t Timebase_SetPeriodicCallBack(uint32_t PeriodMs, void (*CallBack)(void))
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PrimaskState = 0;
+
+	if (NULL == CallBack)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (0u == PeriodMs)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* Tick Must Not See a New Call Back With an Old Period */
+		ENTER_CRITICAL(PrimaskState);
+
+		Timebase_PeriodCounter = 0;
+		Timebase_PeriodMs = PeriodMs;
+		Timebase_CallBack = CallBack;
+
+		EXIT_CRITICAL(PrimaskState);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Millis
+ * @brief			:	Milliseconds Since Timebase_Init , Never Wraps
+ * @param			:	void
+ * @retval			:	Uptime in Milliseconds
+ * ======================================================================================*/
+uint64_t Timebase_Millis(void)
+{
+	uint64_t Millis = 0;
+
+	uint32_t PrimaskState = 0;
+
+	/* 64 Bits Take Two Loads , Tick Must Not Land Between Them */
+	ENTER_CRITICAL(PrimaskState);
+	Millis = Timebase_Ms;
+	EXIT_CRITICAL(PrimaskState);
+
+	return Millis;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Micros
+ * @brief			:	Microseconds Since Timebase_Init , Uptime Refined by SysTick Current Value
+ * @param			:	void
+ * @retval			:	Uptime in Microseconds
+ * @note			:	Stays Monotonic When Called With Interrupts Masked or From a Higher Priority
+ * 						Interrupt , as Long as Tick Interrupt is Held Back Less Than 1 ms
+ * ======================================================================================*/
+uint64_t Timebase_Micros(void)
+{
+	uint64_t Millis = 0;
+
+	uint32_t PrimaskState = 0;
+	uint32_t Reload = 0;
+	uint32_t FirstValue = 0;
+	uint32_t SecondValue = 0;
+	uint32_t TickPending = 0;
+
+	ENTER_CRITICAL(PrimaskState);
+
+	Millis = Timebase_Ms;
+	Reload = SYSTICK->SYST_RVR;
+
+	/* Counter Wrapped But Tick Not Counted Yet if Tick is Pending or Counter Went Up Between Both Reads */
+	FirstValue = SYSTICK->SYST_CVR;
+	TickPending = (SCB->ICSR >> ICSR_PENDSTSET) & 0x01;
+	SecondValue = SYSTICK->SYST_CVR;
+
+	EXIT_CRITICAL(PrimaskState);
+
+	if (TickPending || (SecondValue > FirstValue))
+	{
+		Millis++;
+	}
+
+	/* SysTick Counts Down From Reload Every Millisecond */
+	return (Millis * TIMEBASE_US_PER_MS) + (((uint64_t)(Reload - SecondValue) * TIMEBASE_US_PER_MS) / (Reload + 1u));
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Cycles
+ * @brief			:	DWT Core Cycle Counter , For Sub Microsecond Timestamps
+ * @param			:	void
+ * @retval			:	Cycle Count ( Wraps Every 2^32 Cycles , Use Timebase_ElapsedCycles )
+ * ======================================================================================*/
+uint32_t Timebase_Cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedMs
+ * @brief			:	Milliseconds Passed Since a Timebase_Millis Timestamp
+ * @param			:	StartMs => Timestamp
+ * @retval			:	Elapsed Milliseconds
+ * ======================================================================================*/
+uint64_t Timebase_ElapsedMs(uint64_t StartMs)
+{
+	return Timebase_Millis() - StartMs;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedUs
+ * @brief			:	Microseconds Passed Since a Timebase_Micros Timestamp
+ * @param			:	StartUs => Timestamp
+ * @retval			:	Elapsed Microseconds
+ * ======================================================================================*/
+uint64_t Timebase_ElapsedUs(uint64_t StartUs)
+{
+	return Timebase_Micros() - StartUs;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_ElapsedCycles
+ * @brief			:	Core Cycles Passed Since a Timebase_Cycles Timestamp , Correct Across One Wrap
+ * @param			:	StartCycles => Timestamp
+ * @retval			:	Elapsed Cycles
+ * ======================================================================================*/
+uint32_t Timebase_ElapsedCycles(uint32_t StartCycles)
+{
+	/* Unsigned Subtraction Absorbs One Wrap */
+	return DWT->CYCCNT - StartCycles;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Deadline
+ * @brief			:	Build a Deadline a Number of Milliseconds From Now
+ * @param			:	DelayMs => Milliseconds From Now
+ * @retval			:	Deadline , Check it With Timebase_IsExpired
+ * ======================================================================================*/
+uint64_t Timebase_Deadline(uint32_t DelayMs)
+{
+	return Timebase_Millis() + DelayMs;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_IsExpired
+ * @brief			:	Non Blocking Check of a Deadline
+ * @param			:	Deadline => From Timebase_Deadline
+ * @retval			:	FLAG_SET if Deadline is Reached , Else FLAG_RESET
+ * ======================================================================================*/
+uint8_t Timebase_IsExpired(uint64_t Deadline)
+{
+	/* 64 Bits Uptime Never Wraps , Plain Compare is Enough */
+	return (Timebase_Millis() >= Deadline) ? FLAG_SET : FLAG_RESET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_DelayMs
+ * @brief			:	Wait a Number of Milliseconds
+ * @param			:	DelayMs => Milliseconds to Wait
+ * @retval			:	void
+ * @note			:	Thread Mode Only , Needs Tick Interrupt to Run . Interrupts Use Deadlines Instead
+ * ======================================================================================*/
+void Timebase_DelayMs(uint32_t DelayMs)
+{
+	uint64_t Deadline = Timebase_Deadline(DelayMs);
+
+	/* Every Tick Wakes Core to Check Deadline */
+	while (FLAG_RESET == Timebase_IsExpired(Deadline))
+	{
+		WAIT_FOR_INTERRUPT();
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Sleep
+ * @brief			:	Sleep Till Next Interrupt , Ticks With No Work Are Suppressed : SysTick is
+ * 						Reprogrammed to Fire at Next Timer Expiry or Periodic Call Back ( At Most MaxMs ) ,
+ * 						Uptime & Timer Wheel Are Caught Up on Wake
+ * @param			:	MaxMs => Longest Sleep Wanted by Caller ( Clamped to TIMEBASE_MAX_SLEEP_MS )
+ * @retval			:	void
+ * @note			:	Thread Mode With Interrupts Masked , Wake Up Handler Runs Once Caller Unmasks
+ * ======================================================================================*/
+void Timebase_Sleep(uint32_t MaxMs)
+{
+	/* Ticks Till First Tick With Work , That Tick Still Comes From SysTick Interrupt */
+	uint32_t Budget = TimerWheel_IdleTicks();
+
+	uint32_t Left = 0;
+
+	if ((NULL != Timebase_CallBack) && ((Timebase_PeriodMs - Timebase_PeriodCounter) < Budget))
+	{
+		Budget = Timebase_PeriodMs - Timebase_PeriodCounter;
+	}
+
+	if (MaxMs < Budget)
+	{
+		Budget = MaxMs;
+	}
+
+	if (TIMEBASE_MAX_SLEEP_MS < Budget)
+	{
+		Budget = TIMEBASE_MAX_SLEEP_MS;
+	}
+
+	if (Budget <= 1u)
+	{
+		/* Next Tick Has Work , Plain Sleep Woken by Normal Tick , SysTick Left Running */
+		WAIT_FOR_INTERRUPT();
+	}
+	else
+	{
+		SYSTICK->SYST_CSR &= ~(1UL << CSR_ENABLE);
+
+		/* Cycles Left Till Next Tick */
+		Left = SYSTICK->SYST_CVR;
+
+		if ((Left < (TIMEBASE_MIN_CYCLES + TIMEBASE_STOP_CYCLES)) || ((SCB->ICSR >> ICSR_PENDSTSET) & 0x01))
+		{
+			/* Next Tick is Already Due , Plain Sleep Woken by Normal Tick */
+			SYSTICK->SYST_CSR |= (1UL << CSR_ENABLE);
+
+			WAIT_FOR_INTERRUPT();
+		}
+		else
+		{
+			Timebase_LongSleep(Budget, Left);
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_LongSleep
+ * @brief			:	Sleep on One Long SysTick Period Ending on The Tick That Has Work , Then Catch Up
+ * 						Uptime & Timer Wheel With The Ticks Actually Slept
+ * @param			:	Budget => Ticks Till First Tick With Work ( At Least 2 )
+ * @param			:	Left => Cycles Left Till Next Tick , Read With SysTick Stopped
+ * @retval			:	void
+ * @note			:	Called by Timebase_Sleep With SysTick Stopped & Interrupts Masked
+ * ======================================================================================*/
+static void Timebase_LongSleep(uint32_t Budget, uint32_t Left)
+{
+	uint32_t Reload = 0;
+	uint32_t Passed = 0;
+
+	/* One Long Period Ending on The Tick That Has Work , Less The Cycles Counter Stood Still */
+	Reload = Left + ((Budget - 1u) * TIMEBASE_CYCLES_PER_MS) - TIMEBASE_STOP_CYCLES;
+
+	SYSTICK->SYST_RVR = Reload - 1u;
+	SYSTICK->SYST_CVR = 0;
+	SYSTICK->SYST_CSR |= (1UL << CSR_ENABLE);
+
+	WAIT_FOR_INTERRUPT();
+
+	SYSTICK->SYST_CSR &= ~(1UL << CSR_ENABLE);
+
+	Left = SYSTICK->SYST_CVR;
+
+	if ((SCB->ICSR >> ICSR_PENDSTSET) & 0x01)
+	{
+		/* Whole Budget Slept , Pending Tick Counts Last Millisecond . Counter Reloaded
+		 * The Long Period & Kept Running , That Part Belongs to The Current Millisecond */
+		Passed = Budget - 1u;
+		Left = (Reload - 1u) - Left;
+		Left = (Left < (TIMEBASE_CYCLES_PER_MS - TIMEBASE_MIN_CYCLES)) ? (TIMEBASE_CYCLES_PER_MS - Left) : TIMEBASE_MIN_CYCLES;
+	}
+	else
+	{
+		/* Woken Early by Another Interrupt , Every Whole Millisecond Still Ahead of Counter Was Not Slept */
+		Passed = (Budget - 1u) - (Left / TIMEBASE_CYCLES_PER_MS);
+		Left = Left % TIMEBASE_CYCLES_PER_MS;
+
+		if (Left < TIMEBASE_MIN_CYCLES)
+		{
+			Left = TIMEBASE_MIN_CYCLES;
+		}
+	}
+
+	/* Counter Stands Still Again Till Restarted Below */
+	Left = (Left > (TIMEBASE_MIN_CYCLES + TIMEBASE_STOP_CYCLES)) ? (Left - TIMEBASE_STOP_CYCLES) : TIMEBASE_MIN_CYCLES;
+
+	/* Finish Current Millisecond , Then Back to Normal Ticks ( New Reload is Taken at Next Wrap ) */
+	SYSTICK->SYST_RVR = Left - 1u;
+	SYSTICK->SYST_CVR = 0;
+	SYSTICK->SYST_CSR |= (1UL << CSR_ENABLE);
+	SYSTICK->SYST_RVR = TIMEBASE_CYCLES_PER_MS - 1u;
+
+	/* Slept Ticks Had No Work , Only Count Them */
+	Timebase_Ms += Passed;
+
+	if (NULL != Timebase_CallBack)
+	{
+		Timebase_PeriodCounter += Passed;
+	}
+
+	TimerWheel_Skip(Passed);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timebase_Tick
+ * @brief			:	SysTick Call Back , Counts Uptime , Turns Timer Wheel & Runs Periodic Call Back When Due
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timebase_Tick(void)
+{
+	Timebase_Ms += TIMEBASE_TICK_MS;
+
+	TimerWheel_Tick();
+
+	if (NULL != Timebase_CallBack)
+	{
+		Timebase_PeriodCounter += TIMEBASE_TICK_MS;
+
+		if (Timebase_PeriodCounter >= Timebase_PeriodMs)
+		{
+			Timebase_PeriodCounter = 0;
+			Timebase_CallBack();
+		}
+	}
+}
@@ -0,0 +1,428 @@
+/*
+ ******************************************************************************
+ * @file           : Timer_Wheel.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Hierarchical Software Timer Wheel Implementation
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Timer_Wheel.h"
+#include "../Inc/Timer_Wheel_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Slots , Each One a Circular List of Timers */
+static TIMER_NODE_t TimerWheel_Level0[TIMER_WHEEL_LEVEL0_SIZE];
+static TIMER_NODE_t TimerWheel_Levels[TIMER_WHEEL_UPPER_LEVELS][TIMER_WHEEL_LEVEL_SIZE];
+
+/* Timers Due But Not Called Yet ( More Than TIMER_WHEEL_MAX_EXPIRIES_PER_TICK in One Tick ) */
+static TIMER_NODE_t TimerWheel_Expired;
+
+/* Last Tick Processed by Wheel */
+static uint32_t TimerWheel_Now = 0;
+
+static volatile uint8_t TimerWheel_Ready = FLAG_RESET;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Init
+ * @brief			:	Empty Every Wheel Slot
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Once Before Timebase Starts Ticking The Wheel
+ * ======================================================================================*/
+void TimerWheel_Init(void)
+{
+	uint32_t Slot = 0;
+	uint8_t Level = 0;
+
+	for (Slot = 0; Slot < TIMER_WHEEL_LEVEL0_SIZE; Slot++)
+	{
+		TimerWheel_ListInit(&TimerWheel_Level0[Slot]);
+	}
+
+	for (Level = 0; Level < TIMER_WHEEL_UPPER_LEVELS; Level++)
+	{
+		for (Slot = 0; Slot < TIMER_WHEEL_LEVEL_SIZE; Slot++)
+		{
+			TimerWheel_ListInit(&TimerWheel_Levels[Level][Slot]);
+		}
+	}
+
+	TimerWheel_ListInit(&TimerWheel_Expired);
+
+	TimerWheel_Now = 0;
+	TimerWheel_Ready = FLAG_SET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Start
+ * @brief			:	Start or Restart a Timer , O(1)
+ * @param			:	Timer => Timer to Start
+ * @param			:	DelayMs => First Expiry From Now ( Max TIMER_WHEEL_MAX_DELAY_MS )
+ * @param			:	PeriodMs => Period After First Expiry , 0 For One Shot
+ * @param			:	CallBack => Expiry Call Back , Runs in SysTick Interrupt
+ * @param			:	Context => Passed Back to Call Back ( May be NULL )
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t TimerWheel_Start(TIMER_t *Timer, uint32_t DelayMs, uint32_t PeriodMs, void (*CallBack)(void *Context), void *Context)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PrimaskState = 0;
+
+	if ((NULL == Timer) || (NULL == CallBack))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((FLAG_RESET == TimerWheel_Ready) || (DelayMs > TIMER_WHEEL_MAX_DELAY_MS) || (PeriodMs > TIMER_WHEEL_MAX_DELAY_MS))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* Timers Are Started From Thread Mode & From Interrupts */
+		ENTER_CRITICAL(PrimaskState);
+
+		if (NULL != Timer->Node.Next)
+		{
+			TimerWheel_ListRemove(&Timer->Node);
+		}
+
+		Timer->Expiry = TimerWheel_Now + DelayMs;
+		Timer->PeriodMs = PeriodMs;
+		Timer->CallBack = CallBack;
+		Timer->Context = Context;
+
+		TimerWheel_Insert(Timer);
+
+		EXIT_CRITICAL(PrimaskState);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Stop
+ * @brief			:	Stop a Timer , O(1) , Stopping a Stopped Timer Does Nothing
+ * @param			:	Timer => Timer to Stop
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t TimerWheel_Stop(TIMER_t *Timer)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PrimaskState = 0;
+
+	if (NULL == Timer)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		ENTER_CRITICAL(PrimaskState);
+
+		if (NULL != Timer->Node.Next)
+		{
+			TimerWheel_ListRemove(&Timer->Node);
+		}
+
+		EXIT_CRITICAL(PrimaskState);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_IsActive
+ * @brief			:	Check if a Timer is Waiting For its Expiry
+ * @param			:	Timer => Timer to Check
+ * @retval			:	FLAG_SET if Timer is Running , Else FLAG_RESET
+ * ======================================================================================*/
+uint8_t TimerWheel_IsActive(const TIMER_t *Timer)
+{
+	return ((NULL != Timer) && (NULL != Timer->Node.Next)) ? FLAG_SET : FLAG_RESET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Tick
+ * @brief			:	Advance Wheel One Millisecond & Run Expired Timers , At Most
+ * 						TIMER_WHEEL_MAX_EXPIRIES_PER_TICK Call Backs Per Tick
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called From Timebase SysTick Interrupt
+ * ======================================================================================*/
+void TimerWheel_Tick(void)
+{
+	uint32_t PrimaskState = 0;
+	uint32_t Index = 0;
+	uint8_t Level = 1;
+	uint8_t Expiries = 0;
+
+	TIMER_t *Timer = NULL;
+	void (*CallBack)(void *Context) = NULL;
+	void *Context = NULL;
+
+	if (FLAG_SET == TimerWheel_Ready)
+	{
+		ENTER_CRITICAL(PrimaskState);
+
+		TimerWheel_Now++;
+
+		Index = TimerWheel_Now & TIMER_WHEEL_LEVEL0_MASK;
+
+		/* Level 0 Turned Around , Bring Down The Next Slot of Level 1 , & of Level 2 When Level 1 Turned Around Too ... */
+		if (0u == Index)
+		{
+			while ((Level <= TIMER_WHEEL_UPPER_LEVELS) && (0u == TimerWheel_Cascade(Level, TIMER_WHEEL_LEVEL_INDEX(TimerWheel_Now, Level))))
+			{
+				Level++;
+			}
+		}
+
+		/* Whole Slot Joins Due Timers at Once */
+		TimerWheel_ListSplice(&TimerWheel_Level0[Index], &TimerWheel_Expired);
+
+		EXIT_CRITICAL(PrimaskState);
+
+		do
+		{
+			ENTER_CRITICAL(PrimaskState);
+
+			if (TimerWheel_Expired.Next == &TimerWheel_Expired)
+			{
+				Timer = NULL;
+			}
+			else
+			{
+				/* Node is First Member , So Node Address is Timer Address */
+				Timer = (TIMER_t *)TimerWheel_Expired.Next;
+
+				TimerWheel_ListRemove(&Timer->Node);
+
+				CallBack = Timer->CallBack;
+				Context = Timer->Context;
+
+				/* Rearmed Before Call Back So it Can Stop or Restart its Own Timer ,
+				 * Period Counts From Expiry Not From Now , So Periodic Timers Never Drift */
+				if (0u != Timer->PeriodMs)
+				{
+					Timer->Expiry += Timer->PeriodMs;
+					TimerWheel_Insert(Timer);
+				}
+			}
+
+			EXIT_CRITICAL(PrimaskState);
+
+			if (NULL != Timer)
+			{
+				CallBack(Context);
+				Expiries++;
+			}
+
+		} while ((NULL != Timer) && (Expiries < TIMER_WHEEL_MAX_EXPIRIES_PER_TICK));
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_IdleTicks
+ * @brief			:	Ticks Till The First Tick That May Have Work ( Expiry or Cascade )
+ * @param			:	void
+ * @retval			:	Ticks , At Least 1 , At Most TIMER_WHEEL_MAX_IDLE_TICKS
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+uint32_t TimerWheel_IdleTicks(void)
+{
+	/* Tick Turning Level 0 Back to Slot 0 Cascades , Nothing Can be Skipped Past it */
+	uint32_t Limit = TIMER_WHEEL_LEVEL0_SIZE - (TimerWheel_Now & TIMER_WHEEL_LEVEL0_MASK);
+	uint32_t Ticks = 1;
+
+	TIMER_NODE_t *Slot = NULL;
+
+	if (FLAG_RESET == TimerWheel_Ready)
+	{
+		Ticks = TIMER_WHEEL_MAX_IDLE_TICKS;
+	}
+	else if (TimerWheel_Expired.Next != &TimerWheel_Expired)
+	{
+		/* Call Backs Held Back Last Tick Run Next Tick */
+		Ticks = 1;
+	}
+	else
+	{
+		for (Ticks = 1; Ticks < Limit; Ticks++)
+		{
+			Slot = &TimerWheel_Level0[(TimerWheel_Now + Ticks) & TIMER_WHEEL_LEVEL0_MASK];
+
+			if (Slot->Next != Slot)
+			{
+				break;
+			}
+		}
+	}
+
+	return Ticks;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Skip
+ * @brief			:	Advance Wheel Over Ticks Slept Through Without Work
+ * @param			:	Ticks => Ticks Slept , Less Than TimerWheel_IdleTicks Before Sleep
+ * @retval			:	void
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+void TimerWheel_Skip(uint32_t Ticks)
+{
+	/* Skipped Slots Are Empty & No Cascade Lies Among Them , Only Time Moves */
+	TimerWheel_Now += Ticks;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Insert
+ * @brief			:	Link a Timer in The Slot Matching its Expiry
+ * @param			:	Timer => Timer With Expiry Set
+ * @retval			:	void
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+static void TimerWheel_Insert(TIMER_t *Timer)
+{
+	uint32_t Delta = Timer->Expiry - TimerWheel_Now;
+	uint32_t Expiry = Timer->Expiry;
+	uint8_t Level = 0;
+
+	if ((int32_t)Delta <= 0)
+	{
+		/* Due Already ( Zero Delay , Cascaded on its Expiry Tick or Periodic Timer Held Back ) */
+		TimerWheel_ListAppend(&TimerWheel_Expired, &Timer->Node);
+	}
+	else if (Delta < TIMER_WHEEL_LEVEL0_SIZE)
+	{
+		TimerWheel_ListAppend(&TimerWheel_Level0[Expiry & TIMER_WHEEL_LEVEL0_MASK], &Timer->Node);
+	}
+	else
+	{
+		if (Delta > TIMER_WHEEL_MAX_SPAN)
+		{
+			/* Parked in Farthest Slot , Placed Again by Cascade When it is Reached */
+			Expiry = TimerWheel_Now + TIMER_WHEEL_MAX_SPAN;
+			Delta = TIMER_WHEEL_MAX_SPAN;
+		}
+
+		/* Finest Upper Level Able to Hold Delta */
+		for (Level = 1; Level < TIMER_WHEEL_UPPER_LEVELS; Level++)
+		{
+			if (Delta < (1ul << TIMER_WHEEL_LEVEL_SHIFT(Level + 1u)))
+			{
+				break;
+			}
+		}
+
+		TimerWheel_ListAppend(&TimerWheel_Levels[Level - 1u][TIMER_WHEEL_LEVEL_INDEX(Expiry, Level)], &Timer->Node);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_Cascade
+ * @brief			:	Move Every Timer of an Upper Level Slot Down to Finer Slots
+ * @param			:	Level => Upper Level ( 1 , 2 or 3 )
+ * @param			:	Index => Slot in That Level
+ * @retval			:	Slot Index , 0 Means Next Level Must Cascade Too
+ * @note			:	Interrupts Must be Masked
+ * ======================================================================================*/
+static uint32_t TimerWheel_Cascade(uint8_t Level, uint32_t Index)
+{
+	TIMER_NODE_t Pending;
+	TIMER_t *Timer = NULL;
+
+	/* Slot is Emptied First , Timers May Land Back in The Same Level */
+	TimerWheel_ListInit(&Pending);
+	TimerWheel_ListSplice(&TimerWheel_Levels[Level - 1u][Index], &Pending);
+
+	while (Pending.Next != &Pending)
+	{
+		Timer = (TIMER_t *)Pending.Next;
+
+		TimerWheel_ListRemove(&Timer->Node);
+		TimerWheel_Insert(Timer);
+	}
+
+	return Index;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListInit
+ * @brief			:	Make a List Head Point to Itself ( Empty List )
+ * @param			:	Head => List Head
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListInit(TIMER_NODE_t *Head)
+{
+	Head->Next = Head;
+	Head->Prev = Head;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListAppend
+ * @brief			:	Link a Node at The End of a List
+ * @param			:	Head => List Head
+ * @param			:	Node => Node to Link
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListAppend(TIMER_NODE_t *Head, TIMER_NODE_t *Node)
+{
+	Node->Next = Head;
+	Node->Prev = Head->Prev;
+	Head->Prev->Next = Node;
+	Head->Prev = Node;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListRemove
+ * @brief			:	Unlink a Node From Whatever List Holds it
+ * @param			:	Node => Node to Unlink
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListRemove(TIMER_NODE_t *Node)
+{
+	Node->Prev->Next = Node->Next;
+	Node->Next->Prev = Node->Prev;
+
+	/* Unlinked Node Marks a Stopped Timer */
+	Node->Next = NULL;
+	Node->Prev = NULL;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimerWheel_ListSplice
+ * @brief			:	Move Every Node of a List to The End of Another List , O(1)
+ * @param			:	From => List to Empty
+ * @param			:	To => List Receiving The Nodes
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimerWheel_ListSplice(TIMER_NODE_t *From, TIMER_NODE_t *To)
+{
+	if (From->Next != From)
+	{
+		From->Next->Prev = To->Prev;
+		To->Prev->Next = From->Next;
+		From->Prev->Next = To;
+		To->Prev = From->Prev;
+
+		TimerWheel_ListInit(From);
+	}
+}
@@ -0,0 +1,72 @@
+/*
+ ******************************************************************************
+ * @file           : Dma_Emulator.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side DMA Controller Emulator Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Compiled Only in Host Builds ( HOST_SIMULATION Defined ) , Nothing Moves Data in Host
+ * Register Images , So a Test ( or a Peripheral Model Like The Panda Emulator ) Plays The DMA
+ * Controller : it Moves What a Stream is Programmed For , Raises The Flag & Enters The Stream
+ * Interrupt Handler as Hardware Would
+ *
+ ******************************************************************************
+ */
+#ifndef SIMULATION_INC_DMA_EMULATOR_H_
+#define SIMULATION_INC_DMA_EMULATOR_H_
+
+#ifdef HOST_SIMULATION
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Complete
+ * @brief			:	Run Rest of a Transfer on an Enabled Stream : Move Remaining NDTR Items ( From The
+ * 						Buffer CT Names in Double Buffer Mode ) , Raise Transfer Complete , Then Switch Buffers
+ * 						in Double Buffer Mode or Disable Stream in Normal Mode & Enter Stream Interrupt
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * @note			:	Items Are Moved With Peripheral Data Width , FIFO Packing is Not Emulated
+ * ======================================================================================*/
+Error_State_t DmaEmu_Complete(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Step
+ * @brief			:	One Peripheral Request on an Enabled Stream : Move Next Item & Count NDTR Down ,
+ * 						Transfer Ends as in DmaEmu_Complete Once NDTR Reaches Zero
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * @note			:	For Peripheral Models Pacing a Stream Item by Item ( SPI Shifting a Byte ) , Items
+ * 						Moved So Far Are Counted Here , a Stream Stopped Early & Programmed Again by The
+ * 						Driver ( NDTR Rewritten ) Starts Over From Its First Item
+ * ======================================================================================*/
+Error_State_t DmaEmu_Step(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Fail
+ * @brief			:	Bus Error on an Enabled Stream : Raise Transfer Error , Disable Stream & Enter
+ * 						Stream Interrupt , No Data is Moved
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * ======================================================================================*/
+Error_State_t DmaEmu_Fail(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_FindEnabled
+ * @brief			:	First Enabled Stream of a Controller , For Streams Picked by The Allocator
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Pointer to Variable to Hold The Stream
+ * @retval			:	Error State ( NOK if No Stream is Enabled )
+ * ======================================================================================*/
+Error_State_t DmaEmu_FindEnabled(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t *StreamNumber);
+
+#endif /* HOST_SIMULATION */
+
+#endif /* SIMULATION_INC_DMA_EMULATOR_H_ */
@@ -0,0 +1,100 @@
+/*
+ ******************************************************************************
+ * @file           : Dma_Emulator_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side DMA Controller Emulator Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _DMA_EMULATOR_PRIVATE_H_
+#define _DMA_EMULATOR_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define DMA_EMU_CONTROLLERS			2u
+#define DMA_EMU_STREAMS				8u
+
+/* Streams Sharing One Status / Clear Register & Their Flags Group Positions ( Same as Driver ) */
+#define DMA_EMU_STREAMS_PER_ISR		4u
+#define DMA_EMU_FLAGS_OFFSETS		{0u, 6u, 16u, 22u}
+
+/* Stream Interrupt Handlers , Indexed by Controller Then Stream */
+#define DMA_EMU_HANDLERS																						\
+	{																											\
+		{DMA1_Stream0_IRQHandler, DMA1_Stream1_IRQHandler, DMA1_Stream2_IRQHandler, DMA1_Stream3_IRQHandler,	\
+		 DMA1_Stream4_IRQHandler, DMA1_Stream5_IRQHandler, DMA1_Stream6_IRQHandler, DMA1_Stream7_IRQHandler},	\
+		{DMA2_Stream0_IRQHandler, DMA2_Stream1_IRQHandler, DMA2_Stream2_IRQHandler, DMA2_Stream3_IRQHandler,	\
+		 DMA2_Stream4_IRQHandler, DMA2_Stream5_IRQHandler, DMA2_Stream6_IRQHandler, DMA2_Stream7_IRQHandler}	\
+	}
+
+/* ========================================================================= *
+ *                      DRIVER HANDLERS SECTION                              *
+ * ========================================================================= */
+
+/* Defined by DMA Driver , Normally Only Reached Through Vector Table */
+void DMA1_Stream0_IRQHandler(void);
+void DMA1_Stream1_IRQHandler(void);
+void DMA1_Stream2_IRQHandler(void);
+void DMA1_Stream3_IRQHandler(void);
+void DMA1_Stream4_IRQHandler(void);
+void DMA1_Stream5_IRQHandler(void);
+void DMA1_Stream6_IRQHandler(void);
+void DMA1_Stream7_IRQHandler(void);
+void DMA2_Stream0_IRQHandler(void);
+void DMA2_Stream1_IRQHandler(void);
+void DMA2_Stream2_IRQHandler(void);
+void DMA2_Stream3_IRQHandler(void);
+void DMA2_Stream4_IRQHandler(void);
+void DMA2_Stream5_IRQHandler(void);
+void DMA2_Stream6_IRQHandler(void);
+void DMA2_Stream7_IRQHandler(void);
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Move
+ * @brief			:	Move Items of Current Transfer Following Those Already Moved , Count NDTR Down
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Enabled Stream
+ * @param			:	Items => Number of Items , Not More Than NDTR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_Move(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint32_t Items);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_End
+ * @brief			:	Transfer is Done : Switch Buffers & Reload NDTR in Double Buffer or Circular Mode ,
+ * 						Disable Stream in Normal Mode , Then Raise Transfer Complete
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream Whose NDTR Reached Zero
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_End(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Raise
+ * @brief			:	Apply Clears Driver Wrote Since Last Event , Raise Flag , Enter Stream Interrupt
+ * 						if Flag Interrupt is Enabled , Then Apply Clears Handler Wrote
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream
+ * @param			:	Flag => Flag to Raise ( @DMA_Interrupt_Flag_t )
+ * @param			:	InterruptEnable => Enable Bit of That Flag in Stream CR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_Raise(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_Interrupt_Flag_t Flag, uint8_t InterruptEnable);
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_ApplyClears
+ * @brief			:	Clear Register is Write 1 to Clear , Host Images Only Keep What Was Written ,
+ * 						So Written Bits Are Moved Out of Status Register Here
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream Selecting LISR / LIFCR or HISR / HIFCR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_ApplyClears(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber);
+
+#endif /* _DMA_EMULATOR_PRIVATE_H_ */
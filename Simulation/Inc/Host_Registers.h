@@ -0,0 +1,44 @@
+/*
+ ******************************************************************************
+ * @file           : Host_Registers.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side Register Images Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Compiled Only in Host Builds ( HOST_SIMULATION Defined ) , Every Register Block in
+ * STM32F446xx.h Maps Into These RAM Images So Drivers & Services Link & Run on The Host
+ *
+ ******************************************************************************
+ */
+#ifndef SIMULATION_INC_HOST_REGISTERS_H_
+#define SIMULATION_INC_HOST_REGISTERS_H_
+
+#ifdef HOST_SIMULATION
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Reset Values of Status Registers Drivers Poll Before Writing Data */
+#define HOST_SPI_SR_RESET_VALUE			0x0002u		/* TXE */
+#define HOST_USART_SR_RESET_VALUE		0x00C0u		/* TXE , TC */
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	HostRegisters_Reset
+ * @brief			:	Clear Every Register Image Then Load Reset Values Drivers Wait on
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call at Start of Every Host Test , Nothing Moves Bits Afterwards Except
+ * 						The Code Under Test & The Test Itself
+ * ======================================================================================*/
+void HostRegisters_Reset(void);
+
+#endif /* HOST_SIMULATION */
+
+#endif /* SIMULATION_INC_HOST_REGISTERS_H_ */
@@ -0,0 +1,175 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Emulator.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side Panda Board Emulator Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Compiled Only in Host Builds ( HOST_SIMULATION Defined ) , PandaEmu_RunBus Plays SPI1 & The
+ * Slaves Wired to it : Bytes DMA Writes in SPI1 DR Go to The Slave Whose NSS Line is Low in GPIOA
+ * Output Register , Each Panda Board Decodes Them as Panda Firmware Does
+ *
+ ******************************************************************************
+ */
+#ifndef SIMULATION_INC_PANDA_EMULATOR_H_
+#define SIMULATION_INC_PANDA_EMULATOR_H_
+
+#ifdef HOST_SIMULATION
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Emulated 16x2 Character LCD */
+#define PANDA_EMU_LCD_LINES			2u
+#define PANDA_EMU_LCD_COLUMNS		16u
+
+/* Decoded Frames Kept For Regression Checks ( Oldest Overwritten ) */
+#define PANDA_EMU_LOG_SIZE			64u
+
+/* Events Waiting to be Clocked Back */
+#define PANDA_EMU_EVENTS_SIZE		8u
+
+/* ========================================================================= *
+ *                              TYPES SECTION                                *
+ * ========================================================================= */
+
+/* One Decoded Frame */
+typedef struct
+{
+	uint64_t Timestamp_us;
+	uint8_t Opcode;
+	uint8_t Length;
+	uint8_t Payload[PANDA_LINK_MAX_PAYLOAD_SIZE];
+	uint8_t CRC_Valid;
+
+} PandaEmu_Record_t;
+
+/* Emulated Board Outputs */
+typedef struct
+{
+	char Lcd[PANDA_EMU_LCD_LINES][PANDA_EMU_LCD_COLUMNS + 1];
+	uint8_t GreenLed;
+	uint8_t RedLed;
+	uint8_t Buzzer;
+	uint8_t AlarmNumber;
+
+} PandaEmu_State_t;
+
+/* Latency From RTC Second Change to LCD Showing it */
+typedef struct
+{
+	uint64_t Last_us;
+	uint64_t Min_us;
+	uint64_t Max_us;
+	uint32_t Samples;
+
+} PandaEmu_Latency_t;
+
+/* Last Frame Sent to Clock Node Line ( Raw Bytes , Node Frames Carry Their Own CRC8 ) */
+typedef struct
+{
+	uint8_t Frame[PANDA_LINK_MAX_FRAME_SIZE];
+	uint8_t Size;
+	uint32_t Frames;
+
+} PandaEmu_Node_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_Reset
+ * @brief			:	Clear LCD , LEDs , Buzzer & Frame Log of Every Board , Latency Statistics & Clock
+ * 						Node Capture
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_Reset(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RunBus
+ * @brief			:	Play SPI1 While DMA2 Stream3 Feeds it : Every Byte is Shifted in The Selected
+ * 						Slave & What That Slave Shifts Out Meanwhile is Taken by DMA2 Stream0 , Transfers
+ * 						Started From Completion Handlers Are Played Too , With SPI1 CRC Enabled a Panda
+ * 						Board Gets The CRC Byte After The Last Item
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call Once Code Under Test Queued Frames , Returns When SPI1 Tx Stream is Idle
+ * ======================================================================================*/
+void PandaEmu_RunBus(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_PressButton
+ * @brief			:	Queue Button Event For Next Frame Replies of a Board
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @param			:	Button => Button Number ( PANDA_BUTTON_SILENCE , PANDA_BUTTON_SNOOZE )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_PressButton(PANDA_DEVICE_t Device, uint8_t Button);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SilenceAlarm
+ * @brief			:	Stop Buzzer of a Board & Queue Acknowledge of The Ringing Alarm For its Next
+ * 						Frame Replies
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_SilenceAlarm(PANDA_DEVICE_t Device);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RejectNext
+ * @brief			:	Board Drops Next Frame it Receives & Answers NAK For it , as Panda Firmware Does
+ * 						When its Receive Buffer Overruns
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_RejectNext(PANDA_DEVICE_t Device);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_MarkRtcSecond
+ * @brief			:	Stamp The Moment Simulated RTC Second Changed , Closed When an LCD Shows it
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_MarkRtcSecond(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetState
+ * @brief			:	Current Emulated LCD , LEDs & Buzzer of a Board
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	Pointer to Emulated State , NULL if Device is Not a Panda Board
+ * ======================================================================================*/
+const PandaEmu_State_t *PandaEmu_GetState(PANDA_DEVICE_t Device);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetRecord
+ * @brief			:	Frame Decoded by a Board , by Age
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @param			:	Age => 0 For Latest Frame
+ * @retval			:	Pointer to Record , NULL if That Board Did Not Decode That Many Frames
+ * ======================================================================================*/
+const PandaEmu_Record_t *PandaEmu_GetRecord(PANDA_DEVICE_t Device, uint32_t Age);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetLatency
+ * @brief			:	RTC Second to LCD Update Latency Statistics
+ * @param			:	void
+ * @retval			:	Pointer to Latency Statistics
+ * ======================================================================================*/
+const PandaEmu_Latency_t *PandaEmu_GetLatency(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetNode
+ * @brief			:	Last Clock Node Frame & Number of Node Frames
+ * @param			:	void
+ * @retval			:	Pointer to Clock Node Capture
+ * ======================================================================================*/
+const PandaEmu_Node_t *PandaEmu_GetNode(void);
+
+#endif /* HOST_SIMULATION */
+
+#endif /* SIMULATION_INC_PANDA_EMULATOR_H_ */
@@ -0,0 +1,179 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Emulator_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side Panda Board Emulator Private Header file
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _PANDA_EMULATOR_PRIVATE_H_
+#define _PANDA_EMULATOR_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Display State Fields ( Same Order as Display Stream Payload ) */
+#define PANDA_EMU_SECONDS		0u
+#define PANDA_EMU_MINUTES		1u
+#define PANDA_EMU_HOURS			2u
+#define PANDA_EMU_DAY			3u
+#define PANDA_EMU_MONTH			4u
+#define PANDA_EMU_YEAR			5u
+#define PANDA_EMU_DATE			6u
+#define PANDA_EMU_PHASE			7u
+#define PANDA_EMU_FIELDS		8u
+
+/* Alarm Line : "A" , Alarm Number , Space Then Name Cut to Fit */
+#define PANDA_EMU_ALARM_NAME_COLUMNS	(PANDA_EMU_LCD_COLUMNS - 3u)
+
+/* SPI1 Streams : DMA2 Stream3 Feeds Tx , DMA2 Stream0 Drains Rx */
+#define PANDA_EMU_TX_STREAM				DMA_STREAM3
+#define PANDA_EMU_RX_STREAM				DMA_STREAM0
+
+/* Slaves Wiring , NSS Lines on GPIOA in Device Order ( Same Pins as Panda Link Device Table ) */
+#define PANDA_EMU_NSS_PINS				{4u, 8u, 9u}
+
+/* MISO Level While No Slave Drives it */
+#define PANDA_EMU_IDLE_BYTE				0xFFu
+
+/* ========================================================================= *
+ *                         PRIVATE ENUMS SECTION                             *
+ * ========================================================================= */
+
+/* SPI Slave Frame Decoder States */
+typedef enum
+{
+	PANDA_EMU_WAIT_OPCODE,
+	PANDA_EMU_WAIT_LENGTH,
+	PANDA_EMU_WAIT_PAYLOAD,
+	PANDA_EMU_WAIT_CRC
+
+} PANDA_EMU_RX_STATE_t;
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+/* One Emulated Panda Board */
+typedef struct
+{
+	/* Frame Being Shifted in ( Header , Payload & CRC ) */
+	uint8_t RxFrame[PANDA_LINK_MAX_FRAME_SIZE];
+	uint8_t RxCount;
+	PANDA_EMU_RX_STATE_t RxState;
+
+	/* Decoded Frames Ring */
+	PandaEmu_Record_t Log[PANDA_EMU_LOG_SIZE];
+	uint32_t LogCount;
+
+	/* Board Outputs & Display State Behind The LCD */
+	PandaEmu_State_t State;
+	uint8_t Time[PANDA_EMU_FIELDS];
+
+	/* Bytes Shifted Out on Next Master Reads ( Echo Frames ) */
+	uint8_t Echo[PANDA_LINK_MAX_PAYLOAD_SIZE];
+	uint8_t EchoCount;
+	uint8_t EchoIndex;
+
+	/* Events Waiting For Next Frame Replies */
+	uint8_t Events[PANDA_EMU_EVENTS_SIZE];
+	uint8_t EventsHead;
+	uint8_t EventsCount;
+
+	/* Verdict on Last Complete Frame & Whether Next One is Dropped */
+	uint8_t LastStatus;
+	uint8_t RejectFlag;
+
+} PandaEmu_Board_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SelectedSlave
+ * @brief			:	Slave Whose NSS Line Nucleo Drives Low in GPIOA Output Register
+ * @param			:	void
+ * @retval			:	Selected Device , PANDA_DEVICES_NUMBER if No Line is Low
+ * ======================================================================================*/
+static PANDA_DEVICE_t PandaEmu_SelectedSlave(void);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SlaveRead
+ * @brief			:	Byte Selected Slave Shifts Out on MISO
+ * @param			:	Slave => Selected Device
+ * @retval			:	Byte , MISO Idles High When No Slave Drives it
+ * ======================================================================================*/
+static uint8_t PandaEmu_SlaveRead(PANDA_DEVICE_t Slave);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SlaveWrite
+ * @brief			:	Byte Shifted in Selected Slave From MOSI
+ * @param			:	Slave => Selected Device
+ * @param			:	Data => Received Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_SlaveWrite(PANDA_DEVICE_t Slave, uint8_t Data);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardWrite
+ * @brief			:	Byte Shifted in Panda Board SPI Slave ( What Nucleo Wrote in SPI1 DR )
+ * @param			:	Board => Selected Board
+ * @param			:	Data => Received Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_BoardWrite(PandaEmu_Board_t *Board, uint8_t Data);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardEnd
+ * @brief			:	NSS Rising Edge on Panda Board , Partial Frame is Dropped Without a Verdict
+ * @param			:	Board => Deselected Board
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_BoardEnd(PandaEmu_Board_t *Board);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardRead
+ * @brief			:	Byte Panda Board SPI Slave Shifts Out While Next Byte is Shifted in , Verdict on
+ * 						Previous Frame at Frame Start , Then Echo Bytes , Then Pending Events
+ * @param			:	Board => Selected Board
+ * @retval			:	Byte Read by Nucleo
+ * ======================================================================================*/
+static uint8_t PandaEmu_BoardRead(PandaEmu_Board_t *Board);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_FrameDone
+ * @brief			:	Log Complete Frame & Apply it to Emulated Board
+ * @param			:	Board => Board That Received The Frame
+ * @param			:	CRC_Valid => FLAG_RESET if Software CRC8 Did Not Match
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_FrameDone(PandaEmu_Board_t *Board, uint8_t CRC_Valid);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RenderTime
+ * @brief			:	Write Display State on Board LCD & Close Pending Latency Sample
+ * @param			:	Board => Board Showing The Time
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_RenderTime(PandaEmu_Board_t *Board);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_PushEvent
+ * @brief			:	Queue Event Byte of a Board , Dropped if Queue is Full
+ * @param			:	Board => Board Raising The Event
+ * @param			:	Event => Event Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_PushEvent(PandaEmu_Board_t *Board, uint8_t Event);
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_Now_us
+ * @brief			:	Host Monotonic Time
+ * @param			:	void
+ * @retval			:	Time in Microseconds
+ * ======================================================================================*/
+static uint64_t PandaEmu_Now_us(void);
+
+#endif /* _PANDA_EMULATOR_PRIVATE_H_ */
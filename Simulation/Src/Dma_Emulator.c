@@ -0,0 +1,301 @@
+/*
+ ******************************************************************************
+ * @file           : Dma_Emulator.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side DMA Controller Emulator Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+#ifdef HOST_SIMULATION
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/DMA_Interface.h"
+
+#include "../Inc/Dma_Emulator.h"
+#include "../Inc/Dma_Emulator_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static void (*const DmaEmu_Handler[DMA_EMU_CONTROLLERS][DMA_EMU_STREAMS])(void) = DMA_EMU_HANDLERS;
+
+static const uint8_t DmaEmu_FlagsOffset[DMA_EMU_STREAMS_PER_ISR] = DMA_EMU_FLAGS_OFFSETS;
+
+/* Items Moved in Current Transfer , NDTR Only Counts What is Left */
+static uint32_t DmaEmu_Moved[DMA_EMU_CONTROLLERS][DMA_EMU_STREAMS];
+
+/* NDTR Left by Last Move , Any Other Value Means Driver Programmed a New Transfer */
+static uint32_t DmaEmu_Left[DMA_EMU_CONTROLLERS][DMA_EMU_STREAMS];
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Complete
+ * @brief			:	Run Rest of a Transfer on an Enabled Stream : Move Remaining NDTR Items ( From The
+ * 						Buffer CT Names in Double Buffer Mode ) , Raise Transfer Complete , Then Switch Buffers
+ * 						in Double Buffer Mode or Disable Stream in Normal Mode & Enter Stream Interrupt
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * @note			:	Items Are Moved With Peripheral Data Width , FIFO Packing is Not Emulated
+ * ======================================================================================*/
+Error_State_t DmaEmu_Complete(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	Error_State_t Error_State = OK;
+
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+	volatile DMA_Stream_RegDef_t *Stream = &Controller->STREAM[StreamNumber];
+
+	if (!((Stream->CR >> EN) & 0x01u))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		DmaEmu_Move(DMAController, StreamNumber, Stream->NDTR);
+		DmaEmu_End(DMAController, StreamNumber);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Step
+ * @brief			:	One Peripheral Request on an Enabled Stream : Move Next Item & Count NDTR Down ,
+ * 						Transfer Ends as in DmaEmu_Complete Once NDTR Reaches Zero
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * @note			:	For Peripheral Models Pacing a Stream Item by Item ( SPI Shifting a Byte ) , Items
+ * 						Moved So Far Are Counted Here , a Stream Stopped Early & Programmed Again by The
+ * 						Driver ( NDTR Rewritten ) Starts Over From Its First Item
+ * ======================================================================================*/
+Error_State_t DmaEmu_Step(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	Error_State_t Error_State = OK;
+
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+	volatile DMA_Stream_RegDef_t *Stream = &Controller->STREAM[StreamNumber];
+
+	if (!((Stream->CR >> EN) & 0x01u))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		DmaEmu_Move(DMAController, StreamNumber, 1);
+
+		if (0 == Stream->NDTR)
+		{
+			DmaEmu_End(DMAController, StreamNumber);
+		}
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Fail
+ * @brief			:	Bus Error on an Enabled Stream : Raise Transfer Error , Disable Stream & Enter
+ * 						Stream Interrupt , No Data is Moved
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Stream ( @DMA_STREAMS_t )
+ * @retval			:	Error State ( NOK if Stream is Not Enabled )
+ * ======================================================================================*/
+Error_State_t DmaEmu_Fail(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	Error_State_t Error_State = OK;
+
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+	volatile DMA_Stream_RegDef_t *Stream = &Controller->STREAM[StreamNumber];
+
+	uint32_t CR = Stream->CR;
+
+	if (!((CR >> EN) & 0x01u))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* Hardware Disables a Stream on Transfer Error */
+		Stream->CR &= ~(1ul << EN);
+		DmaEmu_Moved[DMAController][StreamNumber] = 0;
+
+		DmaEmu_Raise(DMAController, StreamNumber, TRANSFER_ERROR_IT_FLAG, (CR >> TEIE) & 0x01u);
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_FindEnabled
+ * @brief			:	First Enabled Stream of a Controller , For Streams Picked by The Allocator
+ * @param			:	DMAController => DMA Controller ( @DMA_CONTROLLER_t )
+ * @param			:	StreamNumber => Pointer to Variable to Hold The Stream
+ * @retval			:	Error State ( NOK if No Stream is Enabled )
+ * ======================================================================================*/
+Error_State_t DmaEmu_FindEnabled(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t *StreamNumber)
+{
+	Error_State_t Error_State = NOK;
+
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+
+	uint8_t Counter = 0;
+
+	for (Counter = 0; (Counter < DMA_EMU_STREAMS) && (Error_State == NOK); Counter++)
+	{
+		if ((Controller->STREAM[Counter].CR >> EN) & 0x01u)
+		{
+			*StreamNumber = (DMA_STREAMS_t)Counter;
+			Error_State = OK;
+		}
+	}
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Move
+ * @brief			:	Move Items of Current Transfer Following Those Already Moved , Count NDTR Down
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Enabled Stream
+ * @param			:	Items => Number of Items , Not More Than NDTR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_Move(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, uint32_t Items)
+{
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+	volatile DMA_Stream_RegDef_t *Stream = &Controller->STREAM[StreamNumber];
+
+	uint32_t CR = Stream->CR;
+	uint32_t Memory = ((CR >> CT) & 0x01u) ? Stream->M1AR : Stream->M0AR;
+
+	uint32_t Source = Stream->PAR, Destination = Memory;
+	uint8_t SourceInc = (CR >> PINC) & 0x01u, DestinationInc = (CR >> MINC) & 0x01u;
+
+	uint32_t ItemSize = 1ul << ((CR >> PSIZE) & 0x03u);
+	uint32_t Item = (Stream->NDTR == DmaEmu_Left[DMAController][StreamNumber]) ? DmaEmu_Moved[DMAController][StreamNumber] : 0;
+
+	if (((CR >> DIR) & 0x03u) == DMA_MEM_TO_PERIPH)
+	{
+		Source = Memory;
+		Destination = Stream->PAR;
+		SourceInc = (CR >> MINC) & 0x01u;
+		DestinationInc = (CR >> PINC) & 0x01u;
+	}
+
+	for (; Items != 0; Items--, Item++)
+	{
+		memcpy((uint8_t *)(uintptr_t)(Destination + (Item * ItemSize * DestinationInc)),
+			   (const uint8_t *)(uintptr_t)(Source + (Item * ItemSize * SourceInc)), ItemSize);
+
+		Stream->NDTR--;
+	}
+
+	DmaEmu_Moved[DMAController][StreamNumber] = Item;
+	DmaEmu_Left[DMAController][StreamNumber] = Stream->NDTR;
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_End
+ * @brief			:	Transfer is Done : Switch Buffers & Reload NDTR in Double Buffer or Circular Mode ,
+ * 						Disable Stream in Normal Mode , Then Raise Transfer Complete
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream Whose NDTR Reached Zero
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_End(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+	volatile DMA_Stream_RegDef_t *Stream = &Controller->STREAM[StreamNumber];
+
+	uint32_t CR = Stream->CR;
+
+	if ((CR >> DBM) & 0x01u)
+	{
+		/* Other Buffer Takes Over , NDTR Reloads & Stream Keeps Running */
+		Stream->CR ^= (1ul << CT);
+		Stream->NDTR = DmaEmu_Moved[DMAController][StreamNumber];
+	}
+	else if ((CR >> CIRC) & 0x01u)
+	{
+		Stream->NDTR = DmaEmu_Moved[DMAController][StreamNumber];
+	}
+	else
+	{
+		/* Normal Mode Ends Here */
+		Stream->CR &= ~(1ul << EN);
+	}
+
+	/* Handler May Program a New Transfer */
+	DmaEmu_Moved[DMAController][StreamNumber] = 0;
+
+	DmaEmu_Raise(DMAController, StreamNumber, TRANSFER_COMPLETE_IT_FLAG, (CR >> TCIE) & 0x01u);
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_Raise
+ * @brief			:	Apply Clears Driver Wrote Since Last Event , Raise Flag , Enter Stream Interrupt
+ * 						if Flag Interrupt is Enabled , Then Apply Clears Handler Wrote
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream
+ * @param			:	Flag => Flag to Raise ( @DMA_Interrupt_Flag_t )
+ * @param			:	InterruptEnable => Enable Bit of That Flag in Stream CR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_Raise(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_Interrupt_Flag_t Flag, uint8_t InterruptEnable)
+{
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+
+	volatile uint32_t *ISR = (StreamNumber < DMA_EMU_STREAMS_PER_ISR) ? &Controller->LISR : &Controller->HISR;
+
+	DmaEmu_ApplyClears(DMAController, StreamNumber);
+
+	*ISR |= (1ul << (DmaEmu_FlagsOffset[StreamNumber % DMA_EMU_STREAMS_PER_ISR] + Flag));
+
+	if (InterruptEnable)
+	{
+		DmaEmu_Handler[DMAController][StreamNumber]();
+
+		DmaEmu_ApplyClears(DMAController, StreamNumber);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	DmaEmu_ApplyClears
+ * @brief			:	Clear Register is Write 1 to Clear , Host Images Only Keep What Was Written ,
+ * 						So Written Bits Are Moved Out of Status Register Here
+ * @param			:	DMAController => DMA Controller
+ * @param			:	StreamNumber => Stream Selecting LISR / LIFCR or HISR / HIFCR
+ * @retval			:	void
+ * ======================================================================================*/
+static void DmaEmu_ApplyClears(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber)
+{
+	DMA_RegDef_t *Controller = (DMAController == DMA1_CONTROLLER) ? DMA1 : DMA2;
+
+	if (StreamNumber < DMA_EMU_STREAMS_PER_ISR)
+	{
+		Controller->LISR &= ~Controller->LIFCR;
+		Controller->LIFCR = 0;
+	}
+	else
+	{
+		Controller->HISR &= ~Controller->HIFCR;
+		Controller->HIFCR = 0;
+	}
+}
+
+#endif /* HOST_SIMULATION */
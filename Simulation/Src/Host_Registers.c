@@ -0,0 +1,64 @@
+/*
+ ******************************************************************************
+ * @file           : Host_Registers.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side Register Images Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+#ifdef HOST_SIMULATION
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Host_Registers.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* APB1 , APB2 , AHB1 Peripherals ( 0x4000 0000 - 0x4007 FFFF ) */
+uint32_t HostRegisters_Periph[HOST_PERIPH_REGION_WORDS];
+
+/* SysTick , NVIC , SCB , DWT & Core Debug ( 0xE000 0000 - 0xE000 FFFF ) */
+uint32_t HostRegisters_Core[HOST_CORE_REGION_WORDS];
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	HostRegisters_Reset
+ * @brief			:	Clear Every Register Image Then Load Reset Values Drivers Wait on
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call at Start of Every Host Test , Nothing Moves Bits Afterwards Except
+ * 						The Code Under Test & The Test Itself
+ * ======================================================================================*/
+void HostRegisters_Reset(void)
+{
+	memset(HostRegisters_Periph, 0, sizeof(HostRegisters_Periph));
+	memset(HostRegisters_Core, 0, sizeof(HostRegisters_Core));
+
+	/* Empty Transmit Buffers , Polled Writes & Idle Waits Go Straight Through */
+	SPI1->SPI_SR = HOST_SPI_SR_RESET_VALUE;
+	SPI2->SPI_SR = HOST_SPI_SR_RESET_VALUE;
+	SPI3->SPI_SR = HOST_SPI_SR_RESET_VALUE;
+	SPI4->SPI_SR = HOST_SPI_SR_RESET_VALUE;
+
+	USART1->SR = HOST_USART_SR_RESET_VALUE;
+	USART2->SR = HOST_USART_SR_RESET_VALUE;
+	USART3->SR = HOST_USART_SR_RESET_VALUE;
+	UART4->SR = HOST_USART_SR_RESET_VALUE;
+	UART5->SR = HOST_USART_SR_RESET_VALUE;
+	USART6->SR = HOST_USART_SR_RESET_VALUE;
+}
+
+#endif /* HOST_SIMULATION */
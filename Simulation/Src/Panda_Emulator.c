@@ -0,0 +1,600 @@
+/*
+ ******************************************************************************
+ * @file           : Panda_Emulator.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Side Panda Board Emulator Implementation
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+#ifdef HOST_SIMULATION
+
+/* clock_gettime & CLOCK_MONOTONIC Are POSIX , Not Declared Under Strict ISO C */
+#define _POSIX_C_SOURCE 199309L
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/DMA_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../Service/Inc/Panda_Link.h"
+
+#include "../Inc/Dma_Emulator.h"
+#include "../Inc/Panda_Emulator.h"
+#include "../Inc/Panda_Emulator_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Every Panda Board on SPI1 , Index is The Device Number */
+static PandaEmu_Board_t PandaEmu_Boards[PANDA_BOARDS_NUMBER];
+
+/* NSS Pin on GPIOA of Every Slave , Index is The Device Number */
+static const uint8_t PandaEmu_NssPins[PANDA_DEVICES_NUMBER] = PANDA_EMU_NSS_PINS;
+
+/* RTC Second Change Waiting For LCD */
+static uint64_t PandaEmu_RtcMark_us = 0;
+static uint8_t PandaEmu_RtcMarkFlag = FLAG_RESET;
+
+static PandaEmu_Latency_t PandaEmu_Latency;
+
+static PandaEmu_Node_t PandaEmu_Node;
+
+static const char *const PandaEmu_Days[8] = {"???", "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_Reset
+ * @brief			:	Clear LCD , LEDs , Buzzer & Frame Log of Every Board , Latency Statistics & Clock
+ * 						Node Capture
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_Reset(void)
+{
+	PandaEmu_Board_t *Board = NULL;
+
+	for (Board = PandaEmu_Boards; Board < &PandaEmu_Boards[PANDA_BOARDS_NUMBER]; Board++)
+	{
+		memset(Board, 0, sizeof(*Board));
+		memset(Board->State.Lcd, ' ', sizeof(Board->State.Lcd));
+		Board->State.Lcd[0][PANDA_EMU_LCD_COLUMNS] = '\0';
+		Board->State.Lcd[1][PANDA_EMU_LCD_COLUMNS] = '\0';
+
+		Board->RxState = PANDA_EMU_WAIT_OPCODE;
+		Board->LastStatus = PANDA_STATUS_ACK;
+		Board->RejectFlag = FLAG_RESET;
+	}
+
+	memset(&PandaEmu_Latency, 0, sizeof(PandaEmu_Latency));
+	memset(&PandaEmu_Node, 0, sizeof(PandaEmu_Node));
+
+	PandaEmu_RtcMarkFlag = FLAG_RESET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RunBus
+ * @brief			:	Play SPI1 While DMA2 Stream3 Feeds it : Every Byte is Shifted in The Selected
+ * 						Slave & What That Slave Shifts Out Meanwhile is Taken by DMA2 Stream0 , Transfers
+ * 						Started From Completion Handlers Are Played Too , With SPI1 CRC Enabled a Panda
+ * 						Board Gets The CRC Byte After The Last Item
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Call Once Code Under Test Queued Frames , Returns When SPI1 Tx Stream is Idle
+ * ======================================================================================*/
+void PandaEmu_RunBus(void)
+{
+	volatile DMA_Stream_RegDef_t *TxStream = &DMA2->STREAM[PANDA_EMU_TX_STREAM];
+	volatile DMA_Stream_RegDef_t *RxStream = &DMA2->STREAM[PANDA_EMU_RX_STREAM];
+
+	PANDA_DEVICE_t Slave = PANDA_DEVICES_NUMBER;
+
+	uint32_t Items = 0, Counter = 0;
+
+	uint8_t ReplyFlag = FLAG_RESET, CRCFlag = FLAG_RESET, Data = 0, CRC8 = 0;
+
+	/* Every Tx Transfer is One Transaction , Its Completion May Start The Next One */
+	while (((TxStream->CR >> EN) & 0x01u) && ((SPI1->SPI_CR2 >> SPI_TXDMAEN) & 0x01u))
+	{
+		Slave = PandaEmu_SelectedSlave();
+		Items = TxStream->NDTR;
+		ReplyFlag = (((RxStream->CR >> EN) & 0x01u) && ((SPI1->SPI_CR2 >> SPI_RXDMAEN) & 0x01u)) ? FLAG_SET : FLAG_RESET;
+		CRCFlag = ((SPI1->SPI_CR1 >> SPI_CRCEN) & 0x01u) ? FLAG_SET : FLAG_RESET;
+		CRC8 = 0;
+
+		if (PANDA_DEVICE_CLOCK_NODE == Slave)
+		{
+			PandaEmu_Node.Size = 0;
+			PandaEmu_Node.Frames++;
+		}
+
+		for (Counter = 0; Counter < Items; Counter++)
+		{
+			/* Slave Loads its Byte Before Master Byte is Shifted in */
+			Data = PandaEmu_SlaveRead(Slave);
+
+			DmaEmu_Step(DMA2_CONTROLLER, PANDA_EMU_TX_STREAM);
+			PandaEmu_SlaveWrite(Slave, (uint8_t)SPI1->SPI_DR);
+
+			/* CRC8 of Bytes Before Then This One is CRC8 of One Byte ( Zero Initial Value ) */
+			CRC8 ^= (uint8_t)SPI1->SPI_DR;
+			CRC8 = PandaLink_CRC8(&CRC8, 1);
+
+			SPI1->SPI_DR = Data;
+			if (FLAG_SET == ReplyFlag)
+			{
+				DmaEmu_Step(DMA2_CONTROLLER, PANDA_EMU_RX_STREAM);
+			}
+		}
+
+		/* SPI CRC Unit Sends TXCRCR After Last DMA Item ( CRCPR 0x07 Matches Link CRC8 ) */
+		if ((FLAG_SET == CRCFlag) && (Slave < PANDA_BOARDS_NUMBER))
+		{
+			PandaEmu_BoardWrite(&PandaEmu_Boards[Slave], CRC8);
+		}
+
+		/* Transaction Ends With Tx Transfer , NSS Rising Edge Resets Board Decoder */
+		if (Slave < PANDA_BOARDS_NUMBER)
+		{
+			PandaEmu_BoardEnd(&PandaEmu_Boards[Slave]);
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_PressButton
+ * @brief			:	Queue Button Event For Next Frame Replies of a Board
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @param			:	Button => Button Number ( PANDA_BUTTON_SILENCE , PANDA_BUTTON_SNOOZE )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_PressButton(PANDA_DEVICE_t Device, uint8_t Button)
+{
+	if (Device < PANDA_BOARDS_NUMBER)
+	{
+		PandaEmu_PushEvent(&PandaEmu_Boards[Device], PANDA_EVENT_BUTTON | (Button & PANDA_EVENT_ARG_MASK));
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SilenceAlarm
+ * @brief			:	Stop Buzzer of a Board & Queue Acknowledge of The Ringing Alarm For its Next
+ * 						Frame Replies
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_SilenceAlarm(PANDA_DEVICE_t Device)
+{
+	PandaEmu_Board_t *Board = NULL;
+
+	if (Device < PANDA_BOARDS_NUMBER)
+	{
+		Board = &PandaEmu_Boards[Device];
+
+		if (FLAG_SET == Board->State.Buzzer)
+		{
+			Board->State.Buzzer = FLAG_RESET;
+			PandaEmu_PushEvent(Board, PANDA_EVENT_ALARM_ACK | (Board->State.AlarmNumber & PANDA_EVENT_ARG_MASK));
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RejectNext
+ * @brief			:	Board Drops Next Frame it Receives & Answers NAK For it , as Panda Firmware Does
+ * 						When its Receive Buffer Overruns
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_RejectNext(PANDA_DEVICE_t Device)
+{
+	if (Device < PANDA_BOARDS_NUMBER)
+	{
+		PandaEmu_Boards[Device].RejectFlag = FLAG_SET;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_MarkRtcSecond
+ * @brief			:	Stamp The Moment Simulated RTC Second Changed , Closed When an LCD Shows it
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void PandaEmu_MarkRtcSecond(void)
+{
+	PandaEmu_RtcMark_us = PandaEmu_Now_us();
+	PandaEmu_RtcMarkFlag = FLAG_SET;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetState
+ * @brief			:	Current Emulated LCD , LEDs & Buzzer of a Board
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @retval			:	Pointer to Emulated State , NULL if Device is Not a Panda Board
+ * ======================================================================================*/
+const PandaEmu_State_t *PandaEmu_GetState(PANDA_DEVICE_t Device)
+{
+	return (Device < PANDA_BOARDS_NUMBER) ? &PandaEmu_Boards[Device].State : NULL;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetRecord
+ * @brief			:	Frame Decoded by a Board , by Age
+ * @param			:	Device => Board ( PANDA_DEVICE_STATUS , PANDA_DEVICE_WALL )
+ * @param			:	Age => 0 For Latest Frame
+ * @retval			:	Pointer to Record , NULL if That Board Did Not Decode That Many Frames
+ * ======================================================================================*/
+const PandaEmu_Record_t *PandaEmu_GetRecord(PANDA_DEVICE_t Device, uint32_t Age)
+{
+	const PandaEmu_Record_t *Record = NULL;
+
+	const PandaEmu_Board_t *Board = NULL;
+
+	if (Device < PANDA_BOARDS_NUMBER)
+	{
+		Board = &PandaEmu_Boards[Device];
+
+		if ((Age < Board->LogCount) && (Age < PANDA_EMU_LOG_SIZE))
+		{
+			Record = &Board->Log[(Board->LogCount - 1 - Age) % PANDA_EMU_LOG_SIZE];
+		}
+	}
+	return Record;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetLatency
+ * @brief			:	RTC Second to LCD Update Latency Statistics
+ * @param			:	void
+ * @retval			:	Pointer to Latency Statistics
+ * ======================================================================================*/
+const PandaEmu_Latency_t *PandaEmu_GetLatency(void)
+{
+	return &PandaEmu_Latency;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_GetNode
+ * @brief			:	Last Clock Node Frame & Number of Node Frames
+ * @param			:	void
+ * @retval			:	Pointer to Clock Node Capture
+ * ======================================================================================*/
+const PandaEmu_Node_t *PandaEmu_GetNode(void)
+{
+	return &PandaEmu_Node;
+}
+
+/* ============================================================================*
+ * 								Private Functions							   *
+ * ============================================================================*/
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SelectedSlave
+ * @brief			:	Slave Whose NSS Line Nucleo Drives Low in GPIOA Output Register
+ * @param			:	void
+ * @retval			:	Selected Device , PANDA_DEVICES_NUMBER if No Line is Low
+ * ======================================================================================*/
+static PANDA_DEVICE_t PandaEmu_SelectedSlave(void)
+{
+	PANDA_DEVICE_t Slave = PANDA_DEVICE_STATUS;
+
+	while ((Slave < PANDA_DEVICES_NUMBER) && ((GPIOA->ODR >> PandaEmu_NssPins[Slave]) & 0x01u))
+	{
+		Slave++;
+	}
+	return Slave;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SlaveRead
+ * @brief			:	Byte Selected Slave Shifts Out on MISO
+ * @param			:	Slave => Selected Device
+ * @retval			:	Byte , MISO Idles High When No Slave Drives it
+ * ======================================================================================*/
+static uint8_t PandaEmu_SlaveRead(PANDA_DEVICE_t Slave)
+{
+	uint8_t Data = PANDA_EMU_IDLE_BYTE;
+
+	if (Slave < PANDA_BOARDS_NUMBER)
+	{
+		Data = PandaEmu_BoardRead(&PandaEmu_Boards[Slave]);
+	}
+	else if (PANDA_DEVICE_CLOCK_NODE == Slave)
+	{
+		/* Verdict Then Padding Repeating it , as an Underrun SPI Slave Does */
+		Data = PANDA_STATUS_ACK;
+	}
+	return Data;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_SlaveWrite
+ * @brief			:	Byte Shifted in Selected Slave From MOSI
+ * @param			:	Slave => Selected Device
+ * @param			:	Data => Received Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_SlaveWrite(PANDA_DEVICE_t Slave, uint8_t Data)
+{
+	if (Slave < PANDA_BOARDS_NUMBER)
+	{
+		PandaEmu_BoardWrite(&PandaEmu_Boards[Slave], Data);
+	}
+	else if ((PANDA_DEVICE_CLOCK_NODE == Slave) && (PandaEmu_Node.Size < sizeof(PandaEmu_Node.Frame)))
+	{
+		/* Clock Node Frames Are Not Panda Frames , Emulator Only Keeps Them */
+		PandaEmu_Node.Frame[PandaEmu_Node.Size++] = Data;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardWrite
+ * @brief			:	Byte Shifted in Panda Board SPI Slave ( What Nucleo Wrote in SPI1 DR )
+ * @param			:	Board => Selected Board
+ * @param			:	Data => Received Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_BoardWrite(PandaEmu_Board_t *Board, uint8_t Data)
+{
+	Board->RxFrame[Board->RxCount++] = Data;
+
+	switch (Board->RxState)
+	{
+	case PANDA_EMU_WAIT_OPCODE:
+		Board->RxState = PANDA_EMU_WAIT_LENGTH;
+		break;
+
+	case PANDA_EMU_WAIT_LENGTH:
+		if (Data > PANDA_LINK_MAX_PAYLOAD_SIZE)
+		{
+			/* Corrupted Header , Resync on Next Byte */
+			Board->RxState = PANDA_EMU_WAIT_OPCODE;
+			Board->RxCount = 0;
+		}
+		else if (0 == Data)
+		{
+			Board->RxState = (PANDA_LINK_CRC != PANDA_LINK_CRC_NONE) ? PANDA_EMU_WAIT_CRC : PANDA_EMU_WAIT_OPCODE;
+			if (PANDA_EMU_WAIT_OPCODE == Board->RxState)
+			{
+				PandaEmu_FrameDone(Board, FLAG_SET);
+			}
+		}
+		else
+		{
+			Board->RxState = PANDA_EMU_WAIT_PAYLOAD;
+		}
+		break;
+
+	case PANDA_EMU_WAIT_PAYLOAD:
+		if (Board->RxCount == (PANDA_LINK_HEADER_SIZE + Board->RxFrame[1]))
+		{
+			Board->RxState = (PANDA_LINK_CRC != PANDA_LINK_CRC_NONE) ? PANDA_EMU_WAIT_CRC : PANDA_EMU_WAIT_OPCODE;
+			if (PANDA_EMU_WAIT_OPCODE == Board->RxState)
+			{
+				PandaEmu_FrameDone(Board, FLAG_SET);
+			}
+		}
+		break;
+
+	case PANDA_EMU_WAIT_CRC:
+		/* Appended by Nucleo Software or by its SPI CRC Unit , Same CRC8 Either Way */
+		Board->RxState = PANDA_EMU_WAIT_OPCODE;
+		PandaEmu_FrameDone(Board, (PandaLink_CRC8(Board->RxFrame, Board->RxCount - 1) == Data) ? FLAG_SET : FLAG_RESET);
+		break;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardEnd
+ * @brief			:	NSS Rising Edge on Panda Board , Partial Frame is Dropped Without a Verdict
+ * @param			:	Board => Deselected Board
+ * @retval			:	void
+ * @note			:	Status Transactions of PANDA_LINK_CRC_HW Mode Never Complete a Frame
+ * ======================================================================================*/
+static void PandaEmu_BoardEnd(PandaEmu_Board_t *Board)
+{
+	Board->RxState = PANDA_EMU_WAIT_OPCODE;
+	Board->RxCount = 0;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_BoardRead
+ * @brief			:	Byte Panda Board SPI Slave Shifts Out While Next Byte is Shifted in , Verdict on
+ * 						Previous Frame at Frame Start , Then Echo Bytes , Then Pending Events
+ * @param			:	Board => Selected Board
+ * @retval			:	Byte Read by Nucleo
+ * ======================================================================================*/
+static uint8_t PandaEmu_BoardRead(PandaEmu_Board_t *Board)
+{
+	uint8_t Data = PANDA_EVENT_NONE;
+
+	if (PANDA_EMU_WAIT_OPCODE == Board->RxState)
+	{
+		Data = Board->LastStatus;
+	}
+	else if (Board->EchoIndex < Board->EchoCount)
+	{
+		Data = Board->Echo[Board->EchoIndex++];
+	}
+	else if (0 != Board->EventsCount)
+	{
+		Data = Board->Events[Board->EventsHead];
+		Board->EventsHead = (Board->EventsHead + 1) % PANDA_EMU_EVENTS_SIZE;
+		Board->EventsCount--;
+	}
+	return Data;
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_FrameDone
+ * @brief			:	Log Complete Frame & Apply it to Emulated Board
+ * @param			:	Board => Board That Received The Frame
+ * @param			:	CRC_Valid => FLAG_RESET if Software CRC8 Did Not Match
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_FrameDone(PandaEmu_Board_t *Board, uint8_t CRC_Valid)
+{
+	PandaEmu_Record_t *Record = &Board->Log[Board->LogCount++ % PANDA_EMU_LOG_SIZE];
+
+	PandaEmu_State_t *State = &Board->State;
+
+	const uint8_t *Payload = &Board->RxFrame[PANDA_LINK_HEADER_SIZE];
+
+	uint8_t Length = Board->RxFrame[1];
+
+	uint8_t Counter = 0, Index = 1;
+
+	Record->Timestamp_us = PandaEmu_Now_us();
+	Record->Opcode = Board->RxFrame[0];
+	Record->Length = Length;
+	Record->CRC_Valid = CRC_Valid;
+	memcpy(Record->Payload, Payload, Length);
+
+	Board->RxCount = 0;
+
+	/* Told to Nucleo at Start of Next Frame , Frames Failing CRC or Overrun Are Dropped */
+	Board->LastStatus = ((FLAG_SET == CRC_Valid) && (FLAG_RESET == Board->RejectFlag)) ? PANDA_STATUS_ACK : PANDA_STATUS_NAK;
+	Board->RejectFlag = FLAG_RESET;
+
+	if (PANDA_STATUS_ACK == Board->LastStatus)
+	{
+		switch (Record->Opcode)
+		{
+		case PANDA_OPCODE_DISPLAY:
+			for (Counter = 0; (Counter < Length) && (Counter < PANDA_EMU_FIELDS); Counter++)
+			{
+				Board->Time[Counter] = Payload[Counter];
+			}
+			PandaEmu_RenderTime(Board);
+			break;
+
+		case PANDA_OPCODE_DISPLAY_DELTA:
+			/* Mask Then Changed Fields in Order */
+			for (Counter = 0; (Counter < PANDA_EMU_FIELDS) && (Index < Length); Counter++)
+			{
+				if (Payload[0] & (1 << Counter))
+				{
+					Board->Time[Counter] = Payload[Index++];
+				}
+			}
+			PandaEmu_RenderTime(Board);
+			break;
+
+		case PANDA_OPCODE_GREEN_LED:
+			State->GreenLed = FLAG_SET;
+			State->RedLed = FLAG_RESET;
+			break;
+
+		case PANDA_OPCODE_RED_LED:
+			State->RedLed = FLAG_SET;
+			State->GreenLed = FLAG_RESET;
+			break;
+
+		case PANDA_OPCODE_ALARM:
+			/* Alarm Number Then Name on Second Line */
+			State->Buzzer = FLAG_SET;
+			State->AlarmNumber = (Length != 0) ? Payload[0] : 0;
+			snprintf(State->Lcd[1], PANDA_EMU_LCD_COLUMNS + 1, "A%u %-13.*s", State->AlarmNumber % 10u,
+					 (Length > PANDA_EMU_ALARM_NAME_COLUMNS) ? (int)PANDA_EMU_ALARM_NAME_COLUMNS : ((Length > 1) ? (int)(Length - 1) : 0),
+					 (const char *)&Payload[1]);
+			break;
+
+		case PANDA_OPCODE_ECHO:
+			memcpy(Board->Echo, Payload, Length);
+			Board->EchoCount = Length;
+			Board->EchoIndex = 0;
+			break;
+
+		default:
+			/* Unknown Opcode , Logged Only */
+			break;
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_RenderTime
+ * @brief			:	Write Display State on Board LCD & Close Pending Latency Sample
+ * @param			:	Board => Board Showing The Time
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_RenderTime(PandaEmu_Board_t *Board)
+{
+	const uint8_t *Time = Board->Time;
+
+	uint64_t Latency_us = 0;
+
+	/* Fields Are Two Digits on Panda LCD */
+	snprintf(Board->State.Lcd[0], PANDA_EMU_LCD_COLUMNS + 1, "%02u:%02u:%02u        ",
+			 Time[PANDA_EMU_HOURS] % 100u, Time[PANDA_EMU_MINUTES] % 100u, Time[PANDA_EMU_SECONDS] % 100u);
+
+	snprintf(Board->State.Lcd[1], PANDA_EMU_LCD_COLUMNS + 1, "%02u/%02u/20%02u %s ",
+			 Time[PANDA_EMU_DATE] % 100u, Time[PANDA_EMU_MONTH] % 100u, Time[PANDA_EMU_YEAR] % 100u,
+			 PandaEmu_Days[(Time[PANDA_EMU_DAY] < 8) ? Time[PANDA_EMU_DAY] : 0]);
+
+	/* New Second is Visible Now , First Board Showing it Closes The Sample */
+	if (FLAG_SET == PandaEmu_RtcMarkFlag)
+	{
+		PandaEmu_RtcMarkFlag = FLAG_RESET;
+
+		Latency_us = PandaEmu_Now_us() - PandaEmu_RtcMark_us;
+
+		PandaEmu_Latency.Last_us = Latency_us;
+		if ((0 == PandaEmu_Latency.Samples) || (Latency_us < PandaEmu_Latency.Min_us))
+		{
+			PandaEmu_Latency.Min_us = Latency_us;
+		}
+		if (Latency_us > PandaEmu_Latency.Max_us)
+		{
+			PandaEmu_Latency.Max_us = Latency_us;
+		}
+		PandaEmu_Latency.Samples++;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_PushEvent
+ * @brief			:	Queue Event Byte of a Board , Dropped if Queue is Full
+ * @param			:	Board => Board Raising The Event
+ * @param			:	Event => Event Byte
+ * @retval			:	void
+ * ======================================================================================*/
+static void PandaEmu_PushEvent(PandaEmu_Board_t *Board, uint8_t Event)
+{
+	if (Board->EventsCount < PANDA_EMU_EVENTS_SIZE)
+	{
+		Board->Events[(Board->EventsHead + Board->EventsCount) % PANDA_EMU_EVENTS_SIZE] = Event;
+		Board->EventsCount++;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	PandaEmu_Now_us
+ * @brief			:	Host Monotonic Time
+ * @param			:	void
+ * @retval			:	Time in Microseconds
+ * ======================================================================================*/
+static uint64_t PandaEmu_Now_us(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64_t)Now.tv_sec * 1000000ull) + ((uint64_t)Now.tv_nsec / 1000ull);
+}
+
+#endif /* HOST_SIMULATION */
@@ -0,0 +1,31 @@
+/*
+ ******************************************************************************
+ * @file           : Host_Test.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Pieces Linked Into Every Host Regression Test
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdio.h>
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+unsigned int Test_Failures = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/* Application Call Back Service Layer Links Against ( Application/main.c on Target ) */
+void SPI_CallBackFunc(void)
+{
+}
@@ -0,0 +1,44 @@
+/*
+ ******************************************************************************
+ * @file           : Host_Test.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Checks Shared by Host Regression Tests
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef SIMULATION_TEST_HOST_TEST_H_
+#define SIMULATION_TEST_HOST_TEST_H_
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Report Failed Condition & Keep Going , Test Exit Code is The Failure Count */
+#define TEST_CHECK(CONDITION)                                                        \
+	do                                                                               \
+	{                                                                                \
+		if (!(CONDITION))                                                            \
+		{                                                                            \
+			printf("%s:%d: Check Failed : %s\n", __FILE__, __LINE__, #CONDITION);    \
+			Test_Failures++;                                                         \
+		}                                                                            \
+	} while (0)
+
+/* Run One Test Case on Fresh Registers & a Fresh Panda Board */
+#define TEST_RUN(TEST_CASE)                \
+	do                                     \
+	{                                      \
+		HostRegisters_Reset();             \
+		PandaEmu_Reset();                  \
+		printf("Running %s\n", #TEST_CASE); \
+		TEST_CASE();                       \
+	} while (0)
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Failures of The Running Test Executable */
+extern unsigned int Test_Failures;
+
+#endif /* SIMULATION_TEST_HOST_TEST_H_ */
@@ -0,0 +1,168 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Alarm_Snooze.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Snoozed Alarms Ring Again From The Timer Wheel , Alarm Time Kept
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../../Service/Inc/Event_Loop.h"
+#include "../../Service/Inc/Service.h"
+#include "../../Service/Inc/Panda_Link.h"
+#include "../../Service/Inc/Timer_Wheel.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Alarm Used by Every Case , Rings at 07:00:00 */
+#define TEST_ALARM_INDEX 1u
+#define TEST_ALARM_HOURS 7u
+
+/* Snooze Delay Set by ALARM_SNOOZE_MINUTES */
+#define TEST_SNOOZE_MS (5ul * 60000ul)
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Alarm Table Set by User , Hours , Minutes , Seconds */
+extern uint8_t AlarmTime[5][3];
+
+/* Alarm Indexes Posted With EVENT_ALARM_MATCH */
+static uint8_t Test_Matches[8];
+static uint8_t Test_MatchesCount = 0;
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+static void Test_AlarmMatch(const EVENT_t *Event)
+{
+	if (Test_MatchesCount < sizeof(Test_Matches))
+	{
+		Test_Matches[Test_MatchesCount++] = Event->Arg;
+	}
+}
+
+static void Test_Setup(void)
+{
+	Test_MatchesCount = 0;
+
+	EventLoop_Init();
+	EventLoop_Subscribe(EVENT_ALARM_MATCH, &Test_AlarmMatch);
+	TimerWheel_Init();
+
+	memset(AlarmTime, 0xFF, sizeof(AlarmTime));
+	AlarmTime[TEST_ALARM_INDEX][0] = TEST_ALARM_HOURS;
+	AlarmTime[TEST_ALARM_INDEX][1] = 0;
+	AlarmTime[TEST_ALARM_INDEX][2] = 0;
+}
+
+/* Feed One RTC Reading to The Alarm Engine & Run Posted Events */
+static void Test_Second(uint8_t Hours, uint8_t Minutes, uint8_t Seconds)
+{
+	DS1307_Config_t Time = {0};
+
+	Time.Hours = Hours;
+	Time.Minutes = Minutes;
+	Time.Seconds = Seconds;
+
+	CompTime(&Time);
+
+	while (0 != EventLoop_Dispatch())
+	{
+	}
+}
+
+static void Test_Ticks(uint32_t Ticks)
+{
+	while (0 != Ticks--)
+	{
+		TimerWheel_Tick();
+	}
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Snooze Rings The Alarm Again After The Delay & Leaves Its Time as Set */
+static void Test_SnoozeRingsAgain(void)
+{
+	Test_Setup();
+
+	Test_Second(TEST_ALARM_HOURS, 0, 0);
+	TEST_CHECK(1 == Test_MatchesCount);
+
+	AlarmEvent(PANDA_EVENT_BUTTON | PANDA_BUTTON_SNOOZE);
+	TEST_CHECK(TEST_ALARM_HOURS == AlarmTime[TEST_ALARM_INDEX][0]);
+	TEST_CHECK(0 == AlarmTime[TEST_ALARM_INDEX][1]);
+	TEST_CHECK(0 == AlarmTime[TEST_ALARM_INDEX][2]);
+
+	/* Snoozed Alarm Does Not Remind Panda While Waiting */
+	Test_Ticks(TEST_SNOOZE_MS - 1u);
+	Test_Second(TEST_ALARM_HOURS, 4, 59);
+	TEST_CHECK(1 == Test_MatchesCount);
+
+	Test_Ticks(1u);
+	Test_Second(TEST_ALARM_HOURS, 5, 0);
+	TEST_CHECK(2 == Test_MatchesCount);
+	TEST_CHECK(TEST_ALARM_INDEX == Test_Matches[1]);
+
+	/* Next Day Rings at The Time User Set */
+	AlarmEvent(PANDA_EVENT_ALARM_ACK | (TEST_ALARM_INDEX + 1u));
+	Test_Second(TEST_ALARM_HOURS, 0, 0);
+	TEST_CHECK(3 == Test_MatchesCount);
+}
+
+/* Silence Drops a Pending Snooze */
+static void Test_SilenceDropsSnooze(void)
+{
+	Test_Setup();
+
+	Test_Second(TEST_ALARM_HOURS, 0, 0);
+	AlarmEvent(PANDA_EVENT_BUTTON | PANDA_BUTTON_SNOOZE);
+	AlarmEvent(PANDA_EVENT_BUTTON | PANDA_BUTTON_SILENCE);
+
+	Test_Ticks(TEST_SNOOZE_MS);
+	Test_Second(TEST_ALARM_HOURS, 5, 0);
+	TEST_CHECK(1 == Test_MatchesCount);
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	TEST_RUN(Test_SnoozeRingsAgain);
+	TEST_RUN(Test_SilenceDropsSnooze);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,271 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Clock_Node.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Clock Node Frames Sent by a Master Clock on SPI1
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+#include "../../Drivers/Inc/DMA_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../../Service/Inc/Event_Loop.h"
+#include "../../Service/Inc/Service.h"
+#include "../../Service/Inc/Panda_Link.h"
+#include "../../Service/Inc/Clock_Node.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+#include "../Inc/Dma_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Alarm Table Frame as Master Sends it : Header , Payload & CRC8 */
+#define TEST_NODE_FRAME_SIZE	(2u + CLOCK_NODE_ALARMS_PAYLOAD_SIZE + 1u)
+
+/* NSS Line of SPI2 Slave ( PB12 ) */
+#define TEST_NODE_NSS_LINE		12u
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Alarm Table Set by User , Hours , Minutes , Seconds */
+extern uint8_t AlarmTime[ALARMS_NUMBER][CLOCK_NODE_ALARM_FIELDS];
+
+/* Defined by EXTI Driver , Normally Only Reached Through Vector Table */
+void EXTI15_10_IRQHandler(void);
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+static void Test_Setup(void)
+{
+	EventLoop_Init();
+	PandaLink_Init();
+	SPI1_DMA_Init();
+}
+
+/* Clock Queued Frames Out , in PANDA_LINK_CRC_HW Mode Each Frame Needs its Status Event Handled First */
+static void Test_RunLink(void)
+{
+	do
+	{
+		PandaEmu_RunBus();
+	} while (0 != EventLoop_Dispatch());
+}
+
+/* Node Side , SPI2 Slave Listening From Fresh Registers , Rx Stream Given Back By Previous Case First */
+static void Test_NodeSetup(void)
+{
+	DMA_ReleaseStream(DMA1_CONTROLLER, DMA_STREAM3);
+
+	TEST_CHECK(OK == ClockNode_Init());
+}
+
+/* Alarm Table Frame Setting Every Field to Value */
+static void Test_NodeEncode(uint8_t *Frame, uint8_t Value)
+{
+	Frame[0] = CLOCK_NODE_OPCODE_ALARMS;
+	Frame[1] = CLOCK_NODE_ALARMS_PAYLOAD_SIZE;
+
+	memset(&Frame[2], Value, CLOCK_NODE_ALARMS_PAYLOAD_SIZE);
+
+	Frame[TEST_NODE_FRAME_SIZE - 1u] = PandaLink_CRC8(Frame, TEST_NODE_FRAME_SIZE - 1u);
+}
+
+/* Master Clocks Bytes Into SPI2 , Rx Stream Drains Each One , Then NSS Rises */
+static void Test_NodeClock(const uint8_t *Bytes, uint8_t Size)
+{
+	uint8_t Counter = 0;
+
+	for (Counter = 0; Counter < Size; Counter++)
+	{
+		SPI2->SPI_DR = Bytes[Counter];
+		DmaEmu_Step(DMA1_CONTROLLER, DMA_STREAM3);
+	}
+
+	/* Host Image Keeps Written Pending Bits , So The Line is Dropped Again After The Handler */
+	EXTI->PR = (1ul << TEST_NODE_NSS_LINE);
+	EXTI15_10_IRQHandler();
+	EXTI->PR = 0;
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Time Frame Reaches Clock Node Line in Node Layout With its CRC8 */
+static void Test_TimeFrame(void)
+{
+	const DS1307_Config_t Time = {.Seconds = 45, .Minutes = 30, .Hours = 12, .Day = DS1307_TUESDAY, .Date = 14, .Month = 9, .Year = 23};
+
+	const uint8_t Expected[] = {CLOCK_NODE_OPCODE_TIME, CLOCK_NODE_TIME_PAYLOAD_SIZE, 45, 30, 12, DS1307_TUESDAY, 9, 23, 14};
+
+	const PandaEmu_Node_t *Node = PandaEmu_GetNode();
+
+	Test_Setup();
+
+	TEST_CHECK(OK == ClockNode_SendTime(&Time));
+	Test_RunLink();
+
+	TEST_CHECK(1 == Node->Frames);
+	TEST_CHECK((sizeof(Expected) + 1u) == Node->Size);
+	TEST_CHECK(0 == memcmp(Expected, Node->Frame, sizeof(Expected)));
+	TEST_CHECK(PandaLink_CRC8(Node->Frame, sizeof(Expected)) == Node->Frame[sizeof(Expected)]);
+
+	/* Panda Boards Never See Node Frames */
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 0));
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_WALL, 0));
+}
+
+/* Alarm Table Frame Carries Every Row , Empty Rows Included */
+static void Test_AlarmsFrame(void)
+{
+	const PandaEmu_Node_t *Node = PandaEmu_GetNode();
+
+	uint8_t Row = 0;
+
+	Test_Setup();
+
+	memset(AlarmTime, 0xFF, sizeof(AlarmTime));
+	AlarmTime[1][0] = 7;
+	AlarmTime[1][1] = 15;
+	AlarmTime[1][2] = 0;
+
+	TEST_CHECK(OK == ClockNode_SendAlarms());
+	Test_RunLink();
+
+	TEST_CHECK(1 == Node->Frames);
+	TEST_CHECK(CLOCK_NODE_OPCODE_ALARMS == Node->Frame[0]);
+	TEST_CHECK(CLOCK_NODE_ALARMS_PAYLOAD_SIZE == Node->Frame[1]);
+	TEST_CHECK((2u + CLOCK_NODE_ALARMS_PAYLOAD_SIZE + 1u) == Node->Size);
+
+	for (Row = 0; Row < ALARMS_NUMBER; Row++)
+	{
+		TEST_CHECK(0 == memcmp(AlarmTime[Row], &Node->Frame[2u + (Row * CLOCK_NODE_ALARM_FIELDS)], CLOCK_NODE_ALARM_FIELDS));
+	}
+	if (0 != Node->Size)
+	{
+		TEST_CHECK(PandaLink_CRC8(Node->Frame, Node->Size - 1u) == Node->Frame[Node->Size - 1u]);
+	}
+}
+
+/* Node Takes Frames of Any Length From Rx Stream Count , One After The Other */
+static void Test_NodeReceive(void)
+{
+	uint8_t Frame[TEST_NODE_FRAME_SIZE];
+
+	Test_NodeSetup();
+
+	/* Nothing Judged Yet */
+	TEST_CHECK(PANDA_STATUS_ACK == SPI2->SPI_DR);
+
+	Test_NodeEncode(Frame, 3);
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE);
+	TEST_CHECK(PANDA_STATUS_ACK == SPI2->SPI_DR);
+
+	ClockNode_Tick();
+	TEST_CHECK(3 == AlarmTime[0][0]);
+	TEST_CHECK(3 == AlarmTime[ALARMS_NUMBER - 1u][CLOCK_NODE_ALARM_FIELDS - 1u]);
+
+	/* Stream is Re-Armed From Buffer Start */
+	Test_NodeEncode(Frame, 5);
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE);
+	TEST_CHECK(PANDA_STATUS_ACK == SPI2->SPI_DR);
+
+	ClockNode_Tick();
+	TEST_CHECK(5 == AlarmTime[0][0]);
+	TEST_CHECK(5 == AlarmTime[ALARMS_NUMBER - 1u][CLOCK_NODE_ALARM_FIELDS - 1u]);
+
+	/* Short Corrupted Frame */
+	Test_NodeClock(Frame, 3);
+	TEST_CHECK(PANDA_STATUS_NAK == SPI2->SPI_DR);
+
+	/* Empty Transaction Only Polls The Verdict */
+	Test_NodeClock(Frame, 0);
+	TEST_CHECK(PANDA_STATUS_NAK == SPI2->SPI_DR);
+}
+
+/* Frame That Overran SPI2 is Dropped Even if Every Byte DMA Moved Checks Out */
+static void Test_NodeOverrun(void)
+{
+	uint8_t Frame[TEST_NODE_FRAME_SIZE];
+
+	Test_NodeSetup();
+
+	memset(AlarmTime, 0, sizeof(AlarmTime));
+
+	Test_NodeEncode(Frame, 7);
+
+	SPI2->SPI_SR |= (1ul << SPI_FLAGS_OVR);
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE);
+	TEST_CHECK(PANDA_STATUS_NAK == SPI2->SPI_DR);
+
+	ClockNode_Tick();
+	TEST_CHECK(0 == AlarmTime[0][0]);
+
+	/* Host Image is Not Cleared by The DR , SR Reads , Play it */
+	SPI2->SPI_SR &= ~(1ul << SPI_FLAGS_OVR);
+
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE);
+	TEST_CHECK(PANDA_STATUS_ACK == SPI2->SPI_DR);
+
+	ClockNode_Tick();
+	TEST_CHECK(7 == AlarmTime[0][0]);
+}
+
+/* Frame Filling The Whole Rx Buffer is Too Long , Stream Ended by Itself Still Re-Arms */
+static void Test_NodeOverlong(void)
+{
+	uint8_t Frame[TEST_NODE_FRAME_SIZE + 1u];
+
+	Test_NodeSetup();
+
+	Test_NodeEncode(Frame, 9);
+	Frame[TEST_NODE_FRAME_SIZE] = 0;
+
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE + 1u);
+	TEST_CHECK(PANDA_STATUS_NAK == SPI2->SPI_DR);
+
+	Test_NodeClock(Frame, TEST_NODE_FRAME_SIZE);
+	TEST_CHECK(PANDA_STATUS_ACK == SPI2->SPI_DR);
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	TEST_RUN(Test_TimeFrame);
+	TEST_RUN(Test_AlarmsFrame);
+	TEST_RUN(Test_NodeReceive);
+	TEST_RUN(Test_NodeOverrun);
+	TEST_RUN(Test_NodeOverlong);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Dma_Chain.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Descriptor Chains of DMA Driver
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/DMA_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../Service/Inc/Panda_Link.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+#include "../Inc/Dma_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+#define TEST_DESTINATION_SIZE	12u
+
+/* Padding Segment Length */
+#define TEST_PAD_SIZE			4u
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Memory to Memory Stream on DMA2 Stream6 , Byte Items , Both Sides Incremented */
+static DMA_INIT_STRUCT_t Test_Config =
+	{
+		.DMAController = DMA2_CONTROLLER, .StreamNumber = DMA_STREAM6, .ChannelNumber = DMA_CHANNEL0, .PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_LOW_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_ENABLE, .Mode = DMA_NORMAL, .DoubleBuffer = DMA_DOUBLE_BUFFER_DIS, .Direction = DMA_MEM_TO_MEM, .EnableIT = {.TransferCompleteIT = DMA_INT_ENABLE, .TransferErrorIT = DMA_INT_ENABLE}, .FIFOMode = DMA_FIFOMODE_ENABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_FULL};
+
+/* Static So DMA 32 Bit Address Registers Can Hold Them */
+static uint8_t Test_Head[] = {'T', 'I', 'M', 'E'};
+static uint8_t Test_Pad = 0xEE;
+static uint8_t Test_Tail[] = {'O', 'K'};
+static uint8_t Test_Destination[TEST_DESTINATION_SIZE];
+
+/* Head , Padding Repeated From One Byte , Then Tail , Back to Back in Destination */
+static const DMA_SEGMENT_t Test_Segments[] = {
+	{(uint32_t *)Test_Head, (uint32_t *)&Test_Destination[0], sizeof(Test_Head), DMA_SEGMENT_FLAG_NONE},
+	{(uint32_t *)&Test_Pad, (uint32_t *)&Test_Destination[4], TEST_PAD_SIZE, DMA_SEGMENT_FLAG_HOLD_SRC},
+	{(uint32_t *)Test_Tail, (uint32_t *)&Test_Destination[8], sizeof(Test_Tail), DMA_SEGMENT_FLAG_NONE},
+};
+
+#define TEST_SEGMENTS_NUMBER	(sizeof(Test_Segments) / sizeof(Test_Segments[0]))
+
+static uint32_t Test_Completes = 0;
+static uint32_t Test_Errors = 0;
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+static void Test_ChainDone(void)
+{
+	Test_Completes++;
+}
+
+static void Test_ChainFailed(void)
+{
+	Test_Errors++;
+}
+
+static void Test_Setup(void)
+{
+	Test_Completes = 0;
+	Test_Errors = 0;
+	memset(Test_Destination, 0, sizeof(Test_Destination));
+
+	DMA_Init(&Test_Config);
+	DMA_SetCallBack(&Test_Config, DMA_TRANSFER_CMP_CALLBACK, &Test_ChainDone);
+	DMA_SetCallBack(&Test_Config, DMA_TRANSFER_ERROR_CALLBACK, &Test_ChainFailed);
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Every Segment Loads The Next From its Interrupt , Call Back Only After Last One */
+static void Test_InTurn(void)
+{
+	const uint8_t Expected[TEST_DESTINATION_SIZE] = {'T', 'I', 'M', 'E', 0xEE, 0xEE, 0xEE, 0xEE, 'O', 'K', 0, 0};
+
+	volatile DMA_Stream_RegDef_t *Stream = &DMA2->STREAM[DMA_STREAM6];
+
+	Test_Setup();
+
+	TEST_CHECK(DMA_OK == DMA_StartChain(&Test_Config, Test_Segments, TEST_SEGMENTS_NUMBER));
+
+	TEST_CHECK((Stream->CR >> EN) & 0x01u);
+	TEST_CHECK(sizeof(Test_Head) == Stream->NDTR);
+	TEST_CHECK((uint32_t)(uintptr_t)Test_Head == Stream->PAR);
+
+	/* One Chain Per Stream at a Time */
+	TEST_CHECK(DMA_NOK == DMA_StartChain(&Test_Config, Test_Segments, TEST_SEGMENTS_NUMBER));
+
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM6));
+
+	/* Padding Holds Source Only For Its Own Segment */
+	TEST_CHECK(0 == Test_Completes);
+	TEST_CHECK(TEST_PAD_SIZE == Stream->NDTR);
+	TEST_CHECK(0 == ((Stream->CR >> PINC) & 0x01u));
+	TEST_CHECK((Stream->CR >> MINC) & 0x01u);
+
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM6));
+
+	TEST_CHECK(0 == Test_Completes);
+	TEST_CHECK((Stream->CR >> PINC) & 0x01u);
+
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM6));
+
+	TEST_CHECK(1 == Test_Completes);
+	TEST_CHECK(0 == Test_Errors);
+	TEST_CHECK(0 == ((Stream->CR >> EN) & 0x01u));
+	TEST_CHECK(0 == memcmp(Expected, Test_Destination, sizeof(Expected)));
+}
+
+/* Transfer Error Drops Rest of The Chain , Only Error Call Back is Called */
+static void Test_ErrorAborts(void)
+{
+	Test_Setup();
+
+	TEST_CHECK(DMA_OK == DMA_StartChain(&Test_Config, Test_Segments, TEST_SEGMENTS_NUMBER));
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM6));
+	TEST_CHECK(OK == DmaEmu_Fail(DMA2_CONTROLLER, DMA_STREAM6));
+
+	TEST_CHECK(1 == Test_Errors);
+	TEST_CHECK(0 == Test_Completes);
+	TEST_CHECK(0 == ((DMA2->STREAM[DMA_STREAM6].CR >> EN) & 0x01u));
+	TEST_CHECK(0 == Test_Destination[8]);
+
+	/* Stream is Free For a New Chain */
+	TEST_CHECK(DMA_OK == DMA_StartChain(&Test_Config, &Test_Segments[2], 1));
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM6));
+
+	TEST_CHECK(1 == Test_Completes);
+	TEST_CHECK('O' == Test_Destination[8]);
+}
+
+/* Chain Needs Normal Mode & Transfer Complete Interrupt , Segments Are Checked Before Start */
+static void Test_Rejects(void)
+{
+	const DMA_SEGMENT_t Empty[] = {
+		{(uint32_t *)Test_Head, (uint32_t *)&Test_Destination[0], sizeof(Test_Head), DMA_SEGMENT_FLAG_NONE},
+		{(uint32_t *)Test_Tail, (uint32_t *)&Test_Destination[8], 0, DMA_SEGMENT_FLAG_NONE},
+	};
+
+	Test_Setup();
+
+	Test_Config.Mode = DMA_CIRCULAR;
+	TEST_CHECK(DMA_NOK == DMA_StartChain(&Test_Config, Test_Segments, TEST_SEGMENTS_NUMBER));
+	Test_Config.Mode = DMA_NORMAL;
+
+	Test_Config.EnableIT.TransferCompleteIT = DMA_INT_DISABLE;
+	TEST_CHECK(DMA_NOK == DMA_StartChain(&Test_Config, Test_Segments, TEST_SEGMENTS_NUMBER));
+	Test_Config.EnableIT.TransferCompleteIT = DMA_INT_ENABLE;
+
+	TEST_CHECK(DMA_NOK == DMA_StartChain(&Test_Config, Test_Segments, 0));
+	TEST_CHECK(DMA_NOK == DMA_StartChain(&Test_Config, Empty, 2));
+
+	TEST_CHECK(0 == ((DMA2->STREAM[DMA_STREAM6].CR >> EN) & 0x01u));
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	TEST_RUN(Test_InTurn);
+	TEST_RUN(Test_ErrorAborts);
+	TEST_RUN(Test_Rejects);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Dma_Double_Buffer.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Double Buffer ( Ping Pong ) Streams of DMA Driver
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/DMA_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../Service/Inc/Panda_Link.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+#include "../Inc/Dma_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Words Per Buffer */
+#define TEST_BUFFER_WORDS		4u
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* USART1 Rx Stream ( DMA2 Stream2 Channel4 ) Receiving Words in Two Buffers */
+static DMA_INIT_STRUCT_t Test_Config =
+	{
+		.DMAController = DMA2_CONTROLLER, .StreamNumber = DMA_STREAM2, .ChannelNumber = DMA_CHANNEL4, .PeriphBurst = DMA_PERIPH_SINGLE_TRANSFER, .MemBurst = DMA_MEM_SINGLE_TRANSFER, .Priority = DMA_LOW_PRIORITY, .MemDataWidth = DMA_MEM_DATA_WIDTH_32BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_32BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE, .Mode = DMA_CIRCULAR, .DoubleBuffer = DMA_DOUBLE_BUFFER_EN, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferCompleteIT = DMA_INT_ENABLE}, .FIFOMode = DMA_FIFOMODE_DISABLE, .FIFOThreshold = DMA_FIFO_THRESHOLD_FULL};
+
+/* Static So DMA 32 Bit Address Registers Can Hold Them */
+static uint32_t Test_PeriphData = 0;
+static uint32_t Test_Buffers[3][TEST_BUFFER_WORDS];
+
+/* What Transfer Complete Call Back Saw */
+static uint32_t Test_Completes = 0;
+static DMA_BUFFER_t Test_DoneBuffer = DMA_BUFFER1;
+static DMA_STREAMS_t Test_DoneStream = DMA_STREAM0;
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+/* Transfer Complete : Buffer Just Filled is Now The Idle One */
+static void Test_BufferDone(DMA_CONTROLLER_t DMAController, DMA_STREAMS_t StreamNumber, DMA_CALLBACK_ID_t CallBackID, void *Context)
+{
+	(void)CallBackID;
+
+	Test_Completes++;
+	Test_DoneStream = StreamNumber;
+
+	DMA_GetIdleBuffer(DMAController, StreamNumber, (DMA_BUFFER_t *)Context);
+}
+
+static void Test_Setup(void)
+{
+	Test_Completes = 0;
+	memset(Test_Buffers, 0, sizeof(Test_Buffers));
+
+	DMA_Init(&Test_Config);
+	DMA_SetContextCallBack(&Test_Config, DMA_TRANSFER_CMP_CALLBACK, &Test_BufferDone, &Test_DoneBuffer);
+}
+
+/* Every Word of a Buffer Holds Value */
+static uint8_t Test_BufferHolds(const uint32_t *Buffer, uint32_t Value)
+{
+	uint8_t Holds = 1;
+	uint8_t Counter = 0;
+
+	for (Counter = 0; Counter < TEST_BUFFER_WORDS; Counter++)
+	{
+		Holds &= (Buffer[Counter] == Value);
+	}
+
+	return Holds;
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Buffers Fill in Turn Without a Restart , Idle One Can be Swapped For a Fresh Buffer */
+static void Test_PingPong(void)
+{
+	Test_Setup();
+
+	TEST_CHECK(DMA_OK == DMA_StartDoubleBuffer(&Test_Config, &Test_PeriphData, Test_Buffers[0], Test_Buffers[1], TEST_BUFFER_WORDS));
+
+	Test_PeriphData = 0x11111111u;
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM2));
+
+	TEST_CHECK(1 == Test_Completes);
+	TEST_CHECK(DMA_STREAM2 == Test_DoneStream);
+	TEST_CHECK(DMA_BUFFER0 == Test_DoneBuffer);
+	TEST_CHECK(Test_BufferHolds(Test_Buffers[0], 0x11111111u));
+	TEST_CHECK(Test_BufferHolds(Test_Buffers[1], 0));
+
+	/* DMA is Filling Buffer 1 Now , Only Buffer 0 May Move */
+	TEST_CHECK(DMA_NOK == DMA_SetBuffer(DMA2_CONTROLLER, DMA_STREAM2, DMA_BUFFER1, Test_Buffers[2]));
+	TEST_CHECK(DMA_OK == DMA_SetBuffer(DMA2_CONTROLLER, DMA_STREAM2, DMA_BUFFER0, Test_Buffers[2]));
+
+	Test_PeriphData = 0x22222222u;
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM2));
+
+	TEST_CHECK(2 == Test_Completes);
+	TEST_CHECK(DMA_BUFFER1 == Test_DoneBuffer);
+	TEST_CHECK(Test_BufferHolds(Test_Buffers[1], 0x22222222u));
+
+	/* Third Buffer Takes Buffer 0 Turn , Old Buffer 0 Keeps First Data */
+	Test_PeriphData = 0x33333333u;
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, DMA_STREAM2));
+
+	TEST_CHECK(3 == Test_Completes);
+	TEST_CHECK(DMA_BUFFER0 == Test_DoneBuffer);
+	TEST_CHECK(Test_BufferHolds(Test_Buffers[2], 0x33333333u));
+	TEST_CHECK(Test_BufferHolds(Test_Buffers[0], 0x11111111u));
+
+	/* Stream Never Stopped */
+	TEST_CHECK((DMA2->STREAM[DMA_STREAM2].CR >> EN) & 0x01u);
+}
+
+/* Double Buffer Needs Double Buffer Mode & a Peripheral , Stopped Stream Takes Both Buffers */
+static void Test_Rejects(void)
+{
+	DMA_BUFFER_t Idle = DMA_BUFFER0;
+
+	Test_Setup();
+
+	Test_Config.DoubleBuffer = DMA_DOUBLE_BUFFER_DIS;
+	TEST_CHECK(DMA_NOK == DMA_StartDoubleBuffer(&Test_Config, &Test_PeriphData, Test_Buffers[0], Test_Buffers[1], TEST_BUFFER_WORDS));
+	Test_Config.DoubleBuffer = DMA_DOUBLE_BUFFER_EN;
+
+	Test_Config.Direction = DMA_MEM_TO_MEM;
+	TEST_CHECK(DMA_NOK == DMA_StartDoubleBuffer(&Test_Config, &Test_PeriphData, Test_Buffers[0], Test_Buffers[1], TEST_BUFFER_WORDS));
+	Test_Config.Direction = DMA_PERIPH_TO_MEM;
+
+	TEST_CHECK(DMA_NOK == DMA_StartDoubleBuffer(&Test_Config, &Test_PeriphData, Test_Buffers[0], NULL, TEST_BUFFER_WORDS));
+	TEST_CHECK(0 == (DMA2->STREAM[DMA_STREAM2].CR & (1ul << EN)));
+
+	TEST_CHECK(DMA_NOK == DMA_GetIdleBuffer(DMA2_CONTROLLER, DMA_STREAM2, NULL));
+	TEST_CHECK(DMA_OK == DMA_GetIdleBuffer(DMA2_CONTROLLER, DMA_STREAM2, &Idle));
+	TEST_CHECK(DMA_BUFFER1 == Idle);
+
+	TEST_CHECK(DMA_OK == DMA_SetBuffer(DMA2_CONTROLLER, DMA_STREAM2, DMA_BUFFER0, Test_Buffers[0]));
+	TEST_CHECK(DMA_OK == DMA_SetBuffer(DMA2_CONTROLLER, DMA_STREAM2, DMA_BUFFER1, Test_Buffers[1]));
+	TEST_CHECK((uint32_t)(uintptr_t)Test_Buffers[1] == DMA2->STREAM[DMA_STREAM2].M1AR);
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	TEST_RUN(Test_PingPong);
+	TEST_RUN(Test_Rejects);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Mem_Dma.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : DMA2 Memory Copy & Fill Service
+ * @Date           : Aug 31, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/DMA_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../Service/Inc/Panda_Link.h"
+#include "../../Service/Inc/Mem_Dma.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+#include "../Inc/Dma_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                            MACROS SECTION                                 *
+ * ========================================================================= */
+
+/* Above MEM_DMA_SYNC_THRESHOLD , Word & Burst Aligned */
+#define TEST_BLOCK_SIZE			64u
+
+/* Above MEM_DMA_SYNC_THRESHOLD , Odd Size at Odd Address Takes Byte Transfers */
+#define TEST_ODD_SIZE			37u
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Static So DMA 32 Bit Address Registers Can Hold Them , Burst Aligned */
+static _Alignas(16) uint8_t Test_Source[TEST_BLOCK_SIZE];
+static _Alignas(16) uint8_t Test_Destination[TEST_BLOCK_SIZE];
+
+static uint32_t Test_Done = 0;
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+static void Test_CallBack(void)
+{
+	Test_Done++;
+}
+
+static void Test_Setup(void)
+{
+	uint8_t Counter = 0;
+
+	Test_Done = 0;
+
+	for (Counter = 0; Counter < TEST_BLOCK_SIZE; Counter++)
+	{
+		Test_Source[Counter] = Counter + 1u;
+	}
+	memset(Test_Destination, 0, sizeof(Test_Destination));
+}
+
+/* Request is on DMA : Nothing Moved Yet & Stream Running */
+static DMA_STREAMS_t Test_RunningStream(void)
+{
+	DMA_STREAMS_t Stream = DMA_STREAM0;
+	MEM_DMA_STATE_t State = MEM_DMA_IDLE;
+
+	TEST_CHECK(OK == DmaEmu_FindEnabled(DMA2_CONTROLLER, &Stream));
+	TEST_CHECK(OK == MemDma_GetState(&State));
+	TEST_CHECK(MEM_DMA_BUSY == State);
+	TEST_CHECK(0 == Test_Done);
+
+	return Stream;
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Aligned Block Goes Word by Word Through DMA , Call Back Once Stream is Done */
+static void Test_CopyWords(void)
+{
+	DMA_STREAMS_t Stream = DMA_STREAM0;
+	MEM_DMA_STATE_t State = MEM_DMA_BUSY;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == MemDma_Copy(Test_Destination, Test_Source, TEST_BLOCK_SIZE, &Test_CallBack));
+
+	Stream = Test_RunningStream();
+	TEST_CHECK(0 != memcmp(Test_Destination, Test_Source, TEST_BLOCK_SIZE));
+
+	/* NDTR Counts Words */
+	TEST_CHECK((TEST_BLOCK_SIZE / 4u) == DMA2->STREAM[Stream].NDTR);
+	TEST_CHECK(DMA_PERIPH_DATA_WIDTH_32BITS == ((DMA2->STREAM[Stream].CR >> PSIZE) & 0x03u));
+
+	/* Stream Busy Until Done */
+	TEST_CHECK(NOK == MemDma_Copy(Test_Destination, Test_Source, TEST_BLOCK_SIZE, &Test_CallBack));
+
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, Stream));
+
+	TEST_CHECK(0 == memcmp(Test_Destination, Test_Source, TEST_BLOCK_SIZE));
+	TEST_CHECK(1 == Test_Done);
+	TEST_CHECK(OK == MemDma_GetState(&State));
+	TEST_CHECK(MEM_DMA_IDLE == State);
+}
+
+/* Odd Block Goes Byte by Byte , Fill Byte Repeated Without Source Increment */
+static void Test_FillBytes(void)
+{
+	DMA_STREAMS_t Stream = DMA_STREAM0;
+	uint8_t Counter = 0;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == MemDma_Fill(&Test_Destination[1], 0xA5, TEST_ODD_SIZE, &Test_CallBack));
+
+	Stream = Test_RunningStream();
+	TEST_CHECK(TEST_ODD_SIZE == DMA2->STREAM[Stream].NDTR);
+	TEST_CHECK(DMA_PERIPH_DATA_WIDTH_8BITS == ((DMA2->STREAM[Stream].CR >> PSIZE) & 0x03u));
+
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, Stream));
+
+	TEST_CHECK(1 == Test_Done);
+	TEST_CHECK(0 == Test_Destination[0]);
+	TEST_CHECK(0 == Test_Destination[TEST_ODD_SIZE + 1u]);
+	for (Counter = 1; Counter <= TEST_ODD_SIZE; Counter++)
+	{
+		TEST_CHECK(0xA5 == Test_Destination[Counter]);
+	}
+}
+
+/* Bus Error Reports Through Same Call Back & Frees Stream For Next Request */
+static void Test_Error(void)
+{
+	DMA_STREAMS_t Stream = DMA_STREAM0;
+	MEM_DMA_STATE_t State = MEM_DMA_IDLE;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == MemDma_Copy(Test_Destination, Test_Source, MEM_DMA_SYNC_THRESHOLD, &Test_CallBack));
+
+	Stream = Test_RunningStream();
+
+	TEST_CHECK(OK == DmaEmu_Fail(DMA2_CONTROLLER, Stream));
+
+	TEST_CHECK(1 == Test_Done);
+	TEST_CHECK(OK == MemDma_GetState(&State));
+	TEST_CHECK(MEM_DMA_ERROR == State);
+
+	TEST_CHECK(OK == MemDma_Copy(Test_Destination, Test_Source, MEM_DMA_SYNC_THRESHOLD, NULL));
+	TEST_CHECK(OK == DmaEmu_Complete(DMA2_CONTROLLER, Stream));
+	TEST_CHECK(0 == memcmp(Test_Destination, Test_Source, MEM_DMA_SYNC_THRESHOLD));
+}
+
+/* Below Threshold CPU Copies Before Return , No Stream is Started */
+static void Test_SmallCopy(void)
+{
+	DMA_STREAMS_t Stream = DMA_STREAM0;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == MemDma_Copy(Test_Destination, Test_Source, MEM_DMA_SYNC_THRESHOLD - 1u, &Test_CallBack));
+
+	TEST_CHECK(1 == Test_Done);
+	TEST_CHECK(0 == memcmp(Test_Destination, Test_Source, MEM_DMA_SYNC_THRESHOLD - 1u));
+	TEST_CHECK(0 == Test_Destination[MEM_DMA_SYNC_THRESHOLD - 1u]);
+	TEST_CHECK(NOK == DmaEmu_FindEnabled(DMA2_CONTROLLER, &Stream));
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	/* Stream Stays Reserved For Whole Executable , Each Request Programs it Again */
+	TEST_CHECK(OK == MemDma_Init());
+
+	TEST_RUN(Test_CopyWords);
+	TEST_RUN(Test_FillBytes);
+	TEST_RUN(Test_Error);
+	TEST_RUN(Test_SmallCopy);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+/*
+ ******************************************************************************
+ * @file           : Test_Panda_Link.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Panda Link Frames Decoded by The Panda Emulator
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+#include "../../Drivers/Inc/SPI_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../../Service/Inc/Event_Loop.h"
+#include "../../Service/Inc/Service.h"
+#include "../../Service/Inc/Panda_Link.h"
+#include "../../Service/Inc/Display_Stream.h"
+
+#include "../Inc/Host_Registers.h"
+#include "../Inc/Panda_Emulator.h"
+
+#include "Host_Test.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Frames Whose Call Back Ran & Delivery State Seen in The Last One */
+static uint8_t Test_SentCount = 0;
+static Error_State_t Test_SentState = NOK;
+
+/* Events Routed From Frame Replies */
+static uint8_t Test_Events[PANDA_EMU_EVENTS_SIZE];
+static uint8_t Test_EventsCount = 0;
+
+/* ========================================================================= *
+ *                         TEST HELPERS SECTION                              *
+ * ========================================================================= */
+
+static void Test_FrameSent(void)
+{
+	Test_SentCount++;
+	Test_SentState = PandaLink_GetFrameState();
+}
+
+static void Test_EventReceived(uint8_t Event)
+{
+	if (Test_EventsCount < PANDA_EMU_EVENTS_SIZE)
+	{
+		Test_Events[Test_EventsCount++] = Event;
+	}
+}
+
+static void Test_Setup(void)
+{
+	Test_SentCount = 0;
+	Test_SentState = NOK;
+	Test_EventsCount = 0;
+
+	EventLoop_Init();
+	PandaLink_Init();
+	PandaLink_SetEventCallBack(&Test_EventReceived);
+	SPI1_DMA_Init();
+}
+
+/* Clock Queued Frames Out , in PANDA_LINK_CRC_HW Mode Each Frame Needs its Status Event Handled First */
+static void Test_RunLink(void)
+{
+	do
+	{
+		PandaEmu_RunBus();
+	} while (0 != EventLoop_Dispatch());
+}
+
+/* ========================================================================= *
+ *                           TEST CASES SECTION                              *
+ * ========================================================================= */
+
+/* Full Display Frame Reaches Panda Byte For Byte & Shows on LCD */
+static void Test_DisplayFrame(void)
+{
+	/* Seconds , Minutes , Hours , Day , Month , Year , Date */
+	const uint8_t Time[PANDA_DISPLAY_PAYLOAD_SIZE] = {45, 30, 12, 3, 9, 23, 14};
+
+	const PandaEmu_Record_t *Record = NULL;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_DISPLAY, Time, sizeof(Time), &Test_FrameSent));
+
+	/* Nothing is Sent Before SPI1 Clocks it Out */
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 0));
+	TEST_CHECK(0 == Test_SentCount);
+
+	Test_RunLink();
+
+	Record = PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 0);
+	TEST_CHECK(NULL != Record);
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 1));
+	if (NULL != Record)
+	{
+		TEST_CHECK(PANDA_OPCODE_DISPLAY == Record->Opcode);
+		TEST_CHECK(sizeof(Time) == Record->Length);
+		TEST_CHECK(0 == memcmp(Time, Record->Payload, sizeof(Time)));
+		TEST_CHECK(FLAG_SET == Record->CRC_Valid);
+	}
+
+	TEST_CHECK(0 == strcmp("12:30:45        ", PandaEmu_GetState(PANDA_DEVICE_STATUS)->Lcd[0]));
+	TEST_CHECK(0 == strcmp("14/09/2023 TUE ", PandaEmu_GetState(PANDA_DEVICE_STATUS)->Lcd[1]));
+
+	TEST_CHECK(1 == Test_SentCount);
+	TEST_CHECK(OK == Test_SentState);
+}
+
+/* Delta Frame Carries Field Mask & Changed Fields Only */
+static void Test_DeltaFrame(void)
+{
+	const uint8_t Time[PANDA_DISPLAY_PAYLOAD_SIZE] = {45, 30, 12, 3, 9, 23, 14};
+
+	/* Seconds & Hours Changed */
+	const uint8_t Delta[] = {0x05, 46, 13};
+
+	const PandaEmu_Record_t *Record = NULL;
+
+	Test_Setup();
+
+	PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_DISPLAY, Time, sizeof(Time), &Test_FrameSent);
+	TEST_CHECK(OK == PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_DISPLAY_DELTA, Delta, sizeof(Delta), &Test_FrameSent));
+	Test_RunLink();
+
+	Record = PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 0);
+	TEST_CHECK(NULL != Record);
+	if (NULL != Record)
+	{
+		TEST_CHECK(PANDA_OPCODE_DISPLAY_DELTA == Record->Opcode);
+		TEST_CHECK(sizeof(Delta) == Record->Length);
+		TEST_CHECK(0 == memcmp(Delta, Record->Payload, sizeof(Delta)));
+	}
+
+	TEST_CHECK(0 == strcmp("13:30:46        ", PandaEmu_GetState(PANDA_DEVICE_STATUS)->Lcd[0]));
+	TEST_CHECK(2 == Test_SentCount);
+}
+
+/* Broadcast Frame is Sent Once Per Panda Board , Owner is Told Once */
+static void Test_Broadcast(void)
+{
+	const PandaEmu_Record_t *Record = NULL;
+
+	PANDA_DEVICE_t Board = PANDA_DEVICE_STATUS;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == PandaLink_SendFrame(PANDA_OPCODE_GREEN_LED, NULL, 0, &Test_FrameSent));
+	Test_RunLink();
+
+	for (Board = PANDA_DEVICE_STATUS; Board < PANDA_BOARDS_NUMBER; Board++)
+	{
+		Record = PandaEmu_GetRecord(Board, 0);
+		TEST_CHECK(NULL != Record);
+		if (NULL != Record)
+		{
+			TEST_CHECK(PANDA_OPCODE_GREEN_LED == Record->Opcode);
+			TEST_CHECK(0 == Record->Length);
+		}
+		TEST_CHECK(NULL == PandaEmu_GetRecord(Board, 1));
+		TEST_CHECK(FLAG_SET == PandaEmu_GetState(Board)->GreenLed);
+	}
+
+	/* Clock Node Takes Node Frames Only */
+	TEST_CHECK(0 == PandaEmu_GetNode()->Frames);
+
+	TEST_CHECK(1 == Test_SentCount);
+}
+
+/* Alarm Frame Rings The Buzzer & Shows Number & Name */
+static void Test_AlarmFrame(void)
+{
+	const uint8_t Alarm[] = {2, 'W', 'a', 'k', 'e'};
+
+	const PandaEmu_Record_t *Record = NULL;
+
+	Test_Setup();
+
+	TEST_CHECK(OK == PandaLink_SendFrameTo(PANDA_DEVICE_WALL, PANDA_OPCODE_ALARM, Alarm, sizeof(Alarm), &Test_FrameSent));
+	Test_RunLink();
+
+	Record = PandaEmu_GetRecord(PANDA_DEVICE_WALL, 0);
+	TEST_CHECK(NULL != Record);
+	if (NULL != Record)
+	{
+		TEST_CHECK(PANDA_OPCODE_ALARM == Record->Opcode);
+		TEST_CHECK(sizeof(Alarm) == Record->Length);
+		TEST_CHECK(0 == memcmp(Alarm, Record->Payload, sizeof(Alarm)));
+	}
+
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_WALL)->Buzzer);
+	TEST_CHECK(2 == PandaEmu_GetState(PANDA_DEVICE_WALL)->AlarmNumber);
+	TEST_CHECK(0 == strcmp("A2 Wake         ", PandaEmu_GetState(PANDA_DEVICE_WALL)->Lcd[1]));
+}
+
+/* Panda Events Come Back in The Reply of The Next Frame */
+static void Test_ReplyEvents(void)
+{
+	const uint8_t Alarm[] = {1, 'G', 'o'};
+
+	Test_Setup();
+
+	PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_ALARM, Alarm, sizeof(Alarm), &Test_FrameSent);
+	Test_RunLink();
+	PandaEmu_PressButton(PANDA_DEVICE_STATUS, PANDA_BUTTON_SNOOZE);
+	PandaEmu_SilenceAlarm(PANDA_DEVICE_STATUS);
+
+	/* Two Reply Bytes After The Status Byte Carry Both Events */
+	PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_RED_LED, Alarm, 2, &Test_FrameSent);
+	Test_RunLink();
+
+	TEST_CHECK(2 == Test_EventsCount);
+	TEST_CHECK((PANDA_EVENT_BUTTON | PANDA_BUTTON_SNOOZE) == Test_Events[0]);
+	TEST_CHECK((PANDA_EVENT_ALARM_ACK | 1) == Test_Events[1]);
+	TEST_CHECK(FLAG_RESET == PandaEmu_GetState(PANDA_DEVICE_STATUS)->Buzzer);
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_STATUS)->RedLed);
+}
+
+/* RTC Second Change Reaches Panda LCD Through Display Stream , One Latency Sample Per Change */
+static void Test_DisplayLatency(void)
+{
+	DS1307_Config_t Time = {.Seconds = 59, .Minutes = 30, .Hours = 12, .Day = DS1307_TUESDAY, .Date = 14, .Month = 9, .Year = 23};
+
+	const PandaEmu_Latency_t *Latency = PandaEmu_GetLatency();
+
+	Test_Setup();
+
+	TEST_CHECK(OK == DisplayStream_Start(DISPLAY_RATE_1HZ));
+
+	/* Keyframe Only , No Second Change Stamped Yet */
+	DisplayStream_Tick(&Time);
+	Test_RunLink();
+	TEST_CHECK(0 == Latency->Samples);
+
+	/* Second Rolls Over , Stream Sends Delta on The Same Tick */
+	Time.Seconds = 0;
+	Time.Minutes = 31;
+	PandaEmu_MarkRtcSecond();
+	DisplayStream_Tick(&Time);
+	Test_RunLink();
+
+	TEST_CHECK(0 == strcmp("12:31:00        ", PandaEmu_GetState(PANDA_DEVICE_STATUS)->Lcd[0]));
+
+	/* Both Boards Render it , First One Closes The Sample */
+	TEST_CHECK(1 == Latency->Samples);
+	TEST_CHECK(Latency->Last_us == Latency->Min_us);
+	TEST_CHECK(Latency->Last_us == Latency->Max_us);
+
+	DisplayStream_Stop();
+}
+
+/* Each Board Judges Its Own Frames : Only The Board That NAKed Gets a Resend */
+static void Test_RejectOneBoard(void)
+{
+#if PANDA_LINK_CRC != PANDA_LINK_CRC_HW
+	const PandaEmu_Record_t *Record = NULL;
+#endif
+
+	Test_Setup();
+
+	/* Wall Drops its Copy of The Broadcast , Status Takes it */
+	PandaEmu_RejectNext(PANDA_DEVICE_WALL);
+	PandaLink_SendFrame(PANDA_OPCODE_GREEN_LED, NULL, 0, &Test_FrameSent);
+	Test_RunLink();
+
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_STATUS)->GreenLed);
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 1));
+
+#if PANDA_LINK_CRC == PANDA_LINK_CRC_HW
+	/* Status Transaction Right After The Frame Carries The NAK , Green is Sent Again to Wall Only */
+	TEST_CHECK(NULL != PandaEmu_GetRecord(PANDA_DEVICE_WALL, 1));
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_WALL, 2));
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_WALL)->GreenLed);
+	TEST_CHECK(1 == Test_SentCount);
+#else
+	TEST_CHECK(FLAG_RESET == PandaEmu_GetState(PANDA_DEVICE_WALL)->GreenLed);
+
+	/* Status ACKs Green in This Reply , Nothing Goes Back on Its Queue */
+	PandaLink_SendFrameTo(PANDA_DEVICE_STATUS, PANDA_OPCODE_RED_LED, NULL, 0, &Test_FrameSent);
+	Test_RunLink();
+
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 2));
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_STATUS)->RedLed);
+
+	/* Wall NAKs Green in This Reply , Green is Sent Again to Wall Only */
+	PandaLink_SendFrameTo(PANDA_DEVICE_WALL, PANDA_OPCODE_RED_LED, NULL, 0, &Test_FrameSent);
+	Test_RunLink();
+
+	Record = PandaEmu_GetRecord(PANDA_DEVICE_WALL, 0);
+	TEST_CHECK(NULL != Record);
+	TEST_CHECK(NULL != PandaEmu_GetRecord(PANDA_DEVICE_WALL, 2));
+	if (NULL != Record)
+	{
+		TEST_CHECK(PANDA_OPCODE_GREEN_LED == Record->Opcode);
+	}
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_WALL)->GreenLed);
+
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 2));
+	TEST_CHECK(FLAG_SET == PandaEmu_GetState(PANDA_DEVICE_STATUS)->RedLed);
+#endif
+}
+
+/* Oversized Payload is Rejected Before Anything is Queued */
+static void Test_Oversized(void)
+{
+	uint8_t Payload[PANDA_LINK_MAX_PAYLOAD_SIZE + 1] = {0};
+
+	Test_Setup();
+
+	TEST_CHECK(NOK == PandaLink_SendFrame(PANDA_OPCODE_DISPLAY, Payload, sizeof(Payload), &Test_FrameSent));
+	TEST_CHECK(NULL == PandaEmu_GetRecord(PANDA_DEVICE_STATUS, 0));
+	TEST_CHECK(0 == Test_SentCount);
+}
+
+/* ========================================================================= *
+ *                              MAIN SECTION                                 *
+ * ========================================================================= */
+
+int main(void)
+{
+	TEST_RUN(Test_DisplayFrame);
+	TEST_RUN(Test_DeltaFrame);
+	TEST_RUN(Test_Broadcast);
+	TEST_RUN(Test_AlarmFrame);
+	TEST_RUN(Test_ReplyEvents);
+	TEST_RUN(Test_DisplayLatency);
+	TEST_RUN(Test_RejectOneBoard);
+	TEST_RUN(Test_Oversized);
+
+	printf("%u Failed Checks\n", Test_Failures);
+
+	return (0 == Test_Failures) ? 0 : 1;
+}